@@ -4,6 +4,7 @@
 // Qt Includes
 #include <QFile>
 #include <QFileInfo>
+#include <QtConcurrentMap>
 
 // Qx Includes
 #include <qx/io/qx-common-io.h>
@@ -46,7 +47,9 @@ QString BackupError::deriveCaption() const { return CAPTION_REVERT_ERR; }
 
 //-Constructor-------------------------------------------------------------
 //Private:
-BackupManager::BackupManager() {}
+BackupManager::BackupManager() :
+    mEntryCount(0)
+{}
 
 //-Class Functions-------------------------------------------------------------
 //Private:
@@ -55,19 +58,70 @@ QString BackupManager::filePathToBackupPath(const QString& filePath)
     return filePath + '.' + BACKUP_FILE_EXT;
 }
 
+BackupError BackupManager::touch(const QString& path)
+{
+    return Qx::createFile(path) ? BackupError() : BackupError(BackupError::FileWontCreate, path);
+}
+
+BackupError BackupManager::stash(const QString& path)
+{
+    QString backupPath = filePathToBackupPath(path);
+
+    if(QFile::exists(backupPath) && QFileInfo(backupPath).isFile())
+    {
+        if(!QFile::remove(backupPath))
+            return BackupError(BackupError::FileWontDelete, backupPath);
+    }
+
+    if(!QFile::rename(path, backupPath))
+        return BackupError(BackupError::FileWontBackup, path);
+
+    return BackupError();
+}
+
+bool BackupManager::hasBackup(Category category) { return category == Category::Remove || category == Category::DocBackup; }
+
 //Public:
 BackupManager* BackupManager::instance() { static BackupManager inst; return &inst; }
 
 //-Instance Functions-------------------------------------------------------------
 //Private:
+BackupManager::Entry BackupManager::makeEntry(const QString& path)
+{
+    // Split off directory, keeping the trailing separator with it
+    qsizetype nameStart = path.lastIndexOf('/') + 1;
+    QString dir = path.left(nameStart);
+
+    // Intern directory
+    auto idItr = mDirectoryIds.constFind(dir);
+    if(idItr == mDirectoryIds.cend())
+    {
+        idItr = mDirectoryIds.insert(dir, mDirectories.size());
+        mDirectories.append(dir);
+    }
+
+    return {.dirId = *idItr, .fileName = path.mid(nameStart)};
+}
+
+QList<BackupManager::Entry>& BackupManager::entries(Category category) { return mLedger[std::to_underlying(category)]; }
+const QList<BackupManager::Entry>& BackupManager::entries(Category category) const { return mLedger[std::to_underlying(category)]; }
+QString BackupManager::entryPath(const Entry& entry) const { return mDirectories.at(entry.dirId) + entry.fileName; }
+
+void BackupManager::record(Category category, const QString& path)
+{
+    entries(category).append(makeEntry(path));
+    mEntryCount++;
+}
+
 BackupError BackupManager::backup(const QString& path, bool (*fn)(const QString& a, const QString& b))
 {
-    // Prevent double+ backups (THIS IS CRITICAL, HENCE WHY A HASH IS USED)
-    if(mRevertables.contains(path))
+    // Prevent double+ backups
+    if(mBackedUp.contains(path))
         return BackupError();
 
     // Note revertable
-    mRevertables[path] = false;
+    mBackedUp.insert(path);
+    record(Category::DocBackup, path);
 
     // Backup if exists
     if(QFile::exists(path))
@@ -87,23 +141,76 @@ BackupError BackupManager::backup(const QString& path, bool (*fn)(const QString&
     return BackupError();
 }
 
-BackupError BackupManager::restore(RevertItr itr)
+BackupError BackupManager::restore(Category category, qsizetype index)
 {
-    Q_ASSERT(itr != mRevertables.cend());
+    QList<Entry>& catEntries = entries(category);
+    Q_ASSERT(index >= 0 && index < catEntries.size());
 
-    const QString path = itr.key();
-    mRevertables.erase(itr);
-    QString backupPath = filePathToBackupPath(path);
+    const QString path = entryPath(catEntries.at(index));
+    catEntries.remove(index);
+    mEntryCount--;
+    if(category == Category::DocBackup)
+        mBackedUp.remove(path);
 
     if(QFile::exists(path) && !QFile::remove(path))
         return BackupError(BackupError::FileWontDelete, path);
 
-    if(!QFile::exists(path) && QFile::exists(backupPath) && !QFile::rename(backupPath, path))
-        return BackupError(BackupError::FileWontRestore, backupPath);
+    // Only some changes have backups to restore
+    if(hasBackup(category))
+    {
+        QString backupPath = filePathToBackupPath(path);
+        if(!QFile::exists(path) && QFile::exists(backupPath) && !QFile::rename(backupPath, path))
+            return BackupError(BackupError::FileWontRestore, backupPath);
+    }
 
     return BackupError();
 }
 
+BackupError BackupManager::bulkOperation(const QStringList& paths, BackupError (*op)(const QString& path), Category category)
+{
+    // Perform file operations in parallel (only touches the filesystem, so no locking required)
+    const QList<BackupError> results = QtConcurrent::blockingMapped<QList<BackupError>>(paths, op);
+
+    // Record all successes in one pass
+    BackupError firstError;
+    QList<Entry>& catEntries = entries(category);
+    catEntries.reserve(catEntries.size() + paths.size());
+    for(qsizetype i = 0; i < paths.size(); ++i)
+    {
+        const BackupError& err = results.at(i);
+        if(!err)
+        {
+            catEntries.append(makeEntry(paths.at(i)));
+            mEntryCount++;
+        }
+        else if(!firstError)
+            firstError = err;
+    }
+
+    return firstError;
+}
+
+void BackupManager::purge(Category category)
+{
+    QList<Entry>& catEntries = entries(category);
+
+    // Discard the backups of removed files
+    if(category == Category::Remove)
+    {
+        QStringList backupPaths;
+        backupPaths.reserve(catEntries.size());
+        for(const Entry& e : std::as_const(catEntries))
+            backupPaths.append(filePathToBackupPath(entryPath(e)));
+
+        QtConcurrent::blockingMap(backupPaths, [](const QString& bp){ QFile::remove(bp); });
+    }
+    else if(category == Category::DocBackup)
+        mBackedUp.clear();
+
+    mEntryCount -= catEntries.size();
+    catEntries.clear();
+}
+
 //Public:
 BackupError BackupManager::backupCopy(const QString& path)
 {
@@ -117,11 +224,16 @@ BackupError BackupManager::backupRename(const QString& path)
 
 BackupError BackupManager::restore(const QString& path)
 {
-    auto store = mRevertables.constFind(path);
-    if(store == mRevertables.cend())
-        return BackupError();
+    // Rarely used, so a linear search is fine
+    for(Category c : magic_enum::enum_values<Category>())
+    {
+        const QList<Entry>& catEntries = entries(c);
+        for(qsizetype i = catEntries.size() - 1; i >= 0; --i)
+            if(entryPath(catEntries.at(i)) == path)
+                return restore(c, i);
+    }
 
-    return restore(store);
+    return BackupError();
 }
 
 BackupError BackupManager::safeReplace(const QString& src, const QString& dst, bool symlink)
@@ -154,17 +266,17 @@ BackupError BackupManager::safeReplace(const QString& src, const QString& dst, b
     if(dstOccupied)
         QFile::remove(backupPath);
     else // Mark new files (only) as revertible so that existing ones will remain in the event of a revert
-        mRevertables[dst] = false;
+        record(Category::NewFile, dst);
 
     return BackupError();
 }
 
 BackupError BackupManager::revertableTouch(const QString& path)
 {
-    if(!Qx::createFile(path))
-        return BackupError(BackupError::FileWontCreate, path);
+    if(BackupError err = touch(path))
+        return err;
 
-    mRevertables[path] = false;
+    record(Category::Touch, path);
     return BackupError();
 }
 
@@ -173,37 +285,36 @@ BackupError BackupManager::revertableTouch(const QString& path)
 BackupError BackupManager::revertableRemove(const QString& path)
 {
     // TODO: Use this for AM extra files
-    QString backupPath = filePathToBackupPath(path);
-
-    if(QFile::exists(backupPath) && QFileInfo(backupPath).isFile())
-    {
-        if(!QFile::remove(backupPath))
-            return BackupError(BackupError::FileWontDelete, backupPath);
-    }
+    if(BackupError err = stash(path))
+        return err;
 
-    if(!QFile::rename(path, backupPath))
-        return BackupError(BackupError::FileWontBackup, path);
-
-    mRevertables[path] = true;
+    record(Category::Remove, path);
     return BackupError();
 }
 
-bool BackupManager::hasReversions() const { return !mRevertables.isEmpty(); }
-int BackupManager::revertQueueCount() const { return mRevertables.size(); }
+BackupError BackupManager::revertableTouch(const QStringList& paths) { return bulkOperation(paths, &BackupManager::touch, Category::Touch); }
+BackupError BackupManager::revertableRemove(const QStringList& paths) { return bulkOperation(paths, &BackupManager::stash, Category::Remove); }
+
+bool BackupManager::hasReversions() const { return mEntryCount > 0; }
+int BackupManager::revertQueueCount() const { return mEntryCount; }
 
 int BackupManager::revertNextChange(BackupError& error, bool skipOnFail)
 {
     // Ensure error message is null
     error = BackupError();
 
-    // Delete new files and restore backups if present
-    if(!mRevertables.isEmpty())
+    // Delete new files and restore backups if present, newest first within each category
+    for(Category c : magic_enum::enum_values<Category>())
     {
-        BackupError rErr = restore(mRevertables.cbegin());
+        const QList<Entry>& catEntries = entries(c);
+        if(catEntries.isEmpty())
+            continue;
+
+        BackupError rErr = restore(c, catEntries.size() - 1);
         if(rErr && !skipOnFail)
             error = rErr;
 
-        return mRevertables.size();
+        return mEntryCount;
     }
 
     // Return 0 if all empty (shouldn't be reached if function is used correctly)
@@ -213,13 +324,12 @@ int BackupManager::revertNextChange(BackupError& error, bool skipOnFail)
 
 void BackupManager::purge()
 {
-    for(auto itr = mRevertables.cbegin(); itr != mRevertables.cend();)
-    {
-        bool purge = itr.value();
-        if(purge)
-            QFile::remove(itr.key());
-        itr = mRevertables.erase(itr); // clazy:exclude=strict-iterators
-    }
+    for(Category c : magic_enum::enum_values<Category>())
+        purge(c);
+
+    // Nothing left to reference the interned directories
+    mDirectories.clear();
+    mDirectoryIds.clear();
 }
 
 }
@@ -3,11 +3,18 @@
 
 // Qt Includes
 #include <QString>
+#include <QStringList>
 #include <QSet>
 
 // Qx Includes
 #include <qx/core/qx-abstracterror.h>
 
+// magic_enum Includes
+#include <magic_enum.hpp>
+
+// Standard Library Includes
+#include <array>
+
 using namespace Qt::StringLiterals;
 
 /*  TODO: The approach, or at least the language around doing a full revert (i.e. emptying the revert
@@ -73,12 +80,28 @@ private:
 
 class BackupManager
 {
+//-Class Enums---------------------------------------------------------------------------
+private:
+    // Declaration order is the order in which each category is reverted
+    enum class Category
+    {
+        Remove,
+        Touch,
+        NewFile,
+        DocBackup
+    };
+
+//-Inner Classes---------------------------------------------------------------------------
+private:
+    struct Entry
+    {
+        quint32 dirId;
+        QString fileName;
+    };
+
 //-Aliases---------------------------------------------------------------------------
 private:
-    using OriginalPath = QString;
-    using Purge = bool;
-    using Reverts = QHash<OriginalPath, Purge>;
-    using RevertItr = Reverts::const_iterator;
+    using Ledger = std::array<QList<Entry>, magic_enum::enum_count<Category>()>;
 
 //-Class Variables-------------------------------------------------------------------
 private:
@@ -87,7 +110,16 @@ private:
 
 //-Instance Variables-------------------------------------------------------------
 private:
-    Reverts mRevertables;
+    // Interned directory prefixes
+    QStringList mDirectories;
+    QHash<QString, quint32> mDirectoryIds;
+
+    // Changes, in the order they were made
+    Ledger mLedger;
+    qsizetype mEntryCount;
+
+    // Prevents double backups (THIS IS CRITICAL), only ever holds document paths so it stays small
+    QSet<QString> mBackedUp;
 
 //-Constructor-------------------------------------------------------------
 private:
@@ -96,14 +128,24 @@ private:
 //-Class Functions-------------------------------------------------------------
 private:
     static QString filePathToBackupPath(const QString& filePath);
+    static BackupError touch(const QString& path);
+    static BackupError stash(const QString& path);
+    static bool hasBackup(Category category);
 
 public:
     static BackupManager* instance();
 
 //-Instance Functions-------------------------------------------------------------
 private:
+    QList<Entry>& entries(Category category);
+    const QList<Entry>& entries(Category category) const;
+    Entry makeEntry(const QString& path);
+    QString entryPath(const Entry& entry) const;
+    void record(Category category, const QString& path);
     BackupError backup(const QString& path, bool (*fn)(const QString& a, const QString& b));
-    BackupError restore(RevertItr itr);
+    BackupError restore(Category category, qsizetype index);
+    BackupError bulkOperation(const QStringList& paths, BackupError (*op)(const QString& path), Category category);
+    void purge(Category category);
 
 public:
     // - If it exists, backs up 'path' via copy, original remains in place to be worked on
@@ -134,9 +176,19 @@ public:
     // - File is restored on revert.
     BackupError revertableRemove(const QString& path);
 
+    // - Bulk versions of the above that process all of 'paths' concurrently
+    // - Every path that was processed successfully is marked accordingly, even if others failed,
+    //   and the first error encountered (in list order) is returned
+    BackupError revertableTouch(const QStringList& paths);
+    BackupError revertableRemove(const QStringList& paths);
+
     bool hasReversions() const;
     int revertQueueCount() const;
+
+    // - Reverts changes one at a time, by category (in declaration order) and then from newest to oldest
     int revertNextChange(BackupError& error, bool skipOnFail);
+
+    // - Forgets all changes, discarding the backups of removed files in bulk
     void purge();
 };
 
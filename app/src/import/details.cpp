@@ -14,7 +14,7 @@ constinit std::optional<Details> Details::mCurrent = std::nullopt;
 
 //-Class Functions--------------------------------------------------------------------------------------------
 //Public:
-Details Details::current() { Q_ASSERT(mCurrent); return mCurrent.value(); }
+const Details& Details::current() { Q_ASSERT(mCurrent); return *mCurrent; }
 
 //Private:
 void Details::setCurrent(const Details& details) { Q_ASSERT(!mCurrent); mCurrent = details; }
@@ -9,6 +9,7 @@
 
 // Project Includes
 #include "import/settings.h"
+#include "kernel/clifp.h"
 
 namespace Import
 {
@@ -22,8 +23,9 @@ struct Details
     QList<QString> involvedPlatforms;
     QList<QString> involvedPlaylists;
     bool forceFullscreen; // TODO: This doesn't quite fit here as installs don't need to know this directly
+    CLIFp::ParametersTemplate clifpParameters; // Compiled once per import, from the above
 
-    static Details current();
+    static const Details& current();
 
 private:
     static constinit std::optional<Details> mCurrent;
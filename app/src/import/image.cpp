@@ -394,7 +394,7 @@ Qx::Error ImageManager::importIcons(bool& canceled, const QStringList& platforms
              * Use translated name for destination since that's what the launcher is expecting
              */
             QString sFilename = p.title() + ".png";
-            QString dFilename = mLauncher->translateDocName(p.title(), Lr::IDataDoc::Type::Playlist) + ".png";;
+            QString dFilename = mLauncher->translatedDocName(p.title(), Lr::IDataDoc::Type::Playlist) + ".png";
             QString source = iconInflateDir.filePath(sFilename);
             QString dest = pdd.absoluteFilePath(dFilename);
 
@@ -55,7 +55,6 @@ Properties::Properties() :
     });
     mLauncherInfo.setBinding([this]{ return mLauncherReady ? mLauncher->name() + ' ' + mLauncher->versionString() : QString(); });
     mFlashpointInfo.setBinding([this]{ return mFlashpointReady ? mFlashpoint->versionInfo()->fullString() : QString(); });
-    mTagMap.setBinding([this]{ return mFlashpointReady ? mFlashpoint->database()->tags() : QMap<int, Fp::Db::TagCategory>(); });
 }
 
 //-Class Functions-------------------------------------------------------------
@@ -111,13 +110,19 @@ void Properties::gatherTargetData()
      * might need to be called in contexts where there is no trivial way to cause the binding to re-evaluate
      * without adding a hacky bool property specifically for that purpose.
      */
+    const QStringList platNames = mFlashpoint->database()->platformNames();
+    const QList<bool> platsExisting = mLauncher->containsPlatforms(platNames);
     QList<Import::Importee> plats;
-    for(const QString& p : mFlashpoint->database()->platformNames())
-        plats.append({.name = p, .existing = mLauncher->containsPlatform(p)});
+    plats.reserve(platNames.size());
+    for(qsizetype i = 0; i < platNames.size(); i++)
+        plats.append({.name = platNames[i], .existing = platsExisting[i]});
 
+    const QStringList playNames = mFlashpoint->playlistManager()->playlistTitles();
+    const QList<bool> playsExisting = mLauncher->containsPlaylists(playNames);
     QList<Import::Importee> plays;
-    for(const QString& p : mFlashpoint->playlistManager()->playlistTitles())
-        plays.append({.name = p, .existing = mLauncher->containsPlaylist(p)});
+    plays.reserve(playNames.size());
+    for(qsizetype i = 0; i < playNames.size(); i++)
+        plays.append({.name = playNames[i], .existing = playsExisting[i]});
 
     mPlatforms.setValue(std::move(plats));
     mPlaylists.setValue(std::move(plays));
@@ -134,8 +139,7 @@ QList<ImageMode> Properties::imageModeOrder() const { return mImageModeOrder; }
 bool Properties::isImageDownloadable() const { return mImageDownloadable; }
 QString Properties::launcherInfo() const { return mLauncherInfo; }
 QString Properties::flashpointInfo() const { return mFlashpointInfo; }
-const Qx::Bindable<QMap<int, Fp::Db::TagCategory>> Properties::bindableTagMap() const { return mTagMap; }
-QMap<int, Fp::Db::TagCategory> Properties::tagMap() const { return mTagMap; }
+QMap<int, Fp::Db::TagCategory> Properties::tagMap() const { return mFlashpointReady ? mFlashpoint->database()->tags() : QMap<int, Fp::Db::TagCategory>(); }
 const Qx::Bindable<QList<Importee>> Properties::bindablePlatforms() const { return mPlatforms; }
 QList<Importee> Properties::platforms() const { return mPlatforms; }
 const Qx::Bindable<QList<Importee>> Properties::bindablePlaylists() const { return mPlaylists; }
@@ -40,7 +40,6 @@ private:
     Qx::Property<bool> mImageDownloadable;
     Qx::Property<QString> mLauncherInfo;
     Qx::Property<QString> mFlashpointInfo;
-    Qx::Property<QMap<int, Fp::Db::TagCategory>> mTagMap;
     Qx::Property<QList<Importee>> mPlatforms;
     Qx::Property<QList<Importee>> mPlaylists;
 
@@ -70,8 +69,7 @@ public:
     bool isImageDownloadable() const;
     QString launcherInfo() const;
     QString flashpointInfo() const;
-    const Qx::Bindable<QMap<int, Fp::Db::TagCategory>> bindableTagMap() const;
-    QMap<int, Fp::Db::TagCategory> tagMap() const;
+    QMap<int, Fp::Db::TagCategory> tagMap() const; // Queried on each call, since it's large and rarely needed
     const Qx::Bindable<QList<Importee>> bindablePlatforms() const;
     QList<Importee> platforms() const;
     const Qx::Bindable<QList<Importee>> bindablePlaylists() const;
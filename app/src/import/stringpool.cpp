@@ -0,0 +1,48 @@
+// Unit Includes
+#include "stringpool.h"
+
+namespace Import
+{
+
+//===============================================================================================================
+// StringPool
+//===============================================================================================================
+
+//-Class Functions--------------------------------------------------------------------------------------------
+//Private:
+void StringPool::clear()
+{
+    QMutexLocker locker(&mMutex);
+    mStrings = {};
+}
+
+//Public:
+QString StringPool::intern(QStringView str)
+{
+    if(str.isEmpty())
+        return QString();
+
+    QMutexLocker locker(&mMutex);
+    if(auto itr = mStrings.constFind(str); itr != mStrings.cend())
+        return itr.value();
+
+    QString pooled = str.toString();
+    mStrings.insert(QStringView(pooled), pooled);
+    return pooled;
+}
+
+QString StringPool::intern(const QString& str)
+{
+    if(str.isEmpty())
+        return str;
+
+    // Same as above, but the string itself can be pooled when it's new
+    QMutexLocker locker(&mMutex);
+    if(auto itr = mStrings.constFind(QStringView(str)); itr != mStrings.cend())
+        return itr.value();
+
+    mStrings.insert(QStringView(str), str);
+    return str;
+}
+
+}
@@ -0,0 +1,37 @@
+#ifndef IMPORT_STRINGPOOL_H
+#define IMPORT_STRINGPOOL_H
+
+/* Many item fields hold the same handful of values across thousands of entries (platforms, developers, the CLIFp
+ * path, XML element names, etc.), so during an import those go through here so that equal strings share a single
+ * buffer instead of each holding their own copy. The pool is emptied when the import ends.
+ */
+
+// Qt Includes
+#include <QHash>
+#include <QMutex>
+#include <QString>
+
+namespace Import
+{
+
+class StringPool
+{
+    friend class Worker;
+//-Class Variables-----------------------------------------------------------------------------------------------
+private:
+    // Keys view the buffer of their value, which is never modified
+    static inline QHash<QStringView, QString> mStrings;
+    static inline QMutex mMutex; // Docs can be read concurrently
+
+//-Class Functions----------------------------------------------------------------------------------------------
+private:
+    static void clear();
+
+public:
+    static QString intern(QStringView str);
+    static QString intern(const QString& str);
+};
+
+}
+
+#endif // IMPORT_STRINGPOOL_H
@@ -8,6 +8,7 @@
 #include "kernel/clifp.h"
 #include "import/details.h"
 #include "import/backup.h"
+#include "import/stringpool.h"
 
 /* TODO: There was an efficiency drop with this since the change to libfp that uses Qx::Sql, as the results are
  * all returned as a list and not something iterable that pulls from the DB as needed. Benchmark this, and
@@ -48,7 +49,11 @@ Worker::Worker(Fp::Install* flashpoint, Lr::IInstall* launcher, Selections impor
 
 //-Destructor---------------------------------------------------------------------------------------------------
 //Public:
-Worker::~Worker() { Details::clearCurrent(); }
+Worker::~Worker()
+{
+    Details::clearCurrent();
+    StringPool::clear();
+}
 
 //-Instance Functions--------------------------------------------------------------------------------------------
 //Private:
@@ -64,21 +69,35 @@ Qx::ProgressGroup* Worker::initializeProgressGroup(const QString& groupName, qui
 Fp::DbError Worker::loadGamesByPlatform(QList<PlatformQueryResult>& games, const QStringList& platforms, const InclusionOptions& inclusions, const QList<QUuid>& idWhitelist)
 {
     games.clear();
+    if(platforms.isEmpty())
+        return {};
+
     games.reserve(platforms.size());
     Fp::Db* db = mFlashpointInstall->database();
 
-    // Build common filter
-    Fp::Db::GameFilter gf{.excludedTagIds = inclusions.excludedTagIds, .includedIds = idWhitelist, .includeAnimations = inclusions.includeAnimations};
-
-    // Load one platform at a time
+    // Prepare a group for each platform, in the order they were given
+    QHash<QString, qsizetype> groupIndex;
+    groupIndex.reserve(platforms.size());
     for(const auto& pf : platforms)
     {
-        PlatformQueryResult& res = games.emplaceBack();
-        res.platform = pf;
-        gf.platforms = {pf};
+        groupIndex.insert(pf, games.size());
+        games.emplaceBack().platform = pf;
+    }
 
-        if(auto err = db->searchGames(res.result, gf); err.isValid())
-            return err;
+    // Load all platforms in one pass over the games table instead of one per platform
+    Fp::Db::GameFilter gf{.excludedTagIds = inclusions.excludedTagIds, .includedIds = idWhitelist, .includeAnimations = inclusions.includeAnimations};
+    gf.platforms = platforms;
+
+    QList<Fp::Game> allGames;
+    if(auto err = db->searchGames(allGames, gf); err.isValid())
+        return err;
+
+    // Split them back up by platform, which keeps their relative order
+    for(Fp::Game& game : allGames)
+    {
+        auto itr = groupIndex.constFind(game.platformName());
+        if(itr != groupIndex.cend())
+            games[*itr].result.append(std::move(game));
     }
 
     return {};
@@ -107,11 +126,24 @@ Qx::Error Worker::preloadPlaylists(QList<Fp::Playlist>& targetPlaylists)
 
 QList<QUuid> Worker::getPlaylistSpecificGameIds(const QList<Fp::Playlist>& playlists)
 {
+    /* Games are often in more than one playlist, and the list ends up inlined into the game query's SQL, so only
+     * add each once to keep that statement as small as possible.
+     */
     QList<QUuid> playlistSpecGameIds;
+    QSet<QUuid> seenIds;
 
     for(const Fp::Playlist& pl : playlists)
+    {
         for(const Fp::PlaylistGame& plg : pl.playlistGames())
-            playlistSpecGameIds.append(plg.gameId());
+        {
+            QUuid id = plg.gameId();
+            if(!seenIds.contains(id))
+            {
+                seenIds.insert(id);
+                playlistSpecGameIds.append(id);
+            }
+        }
+    }
 
     return playlistSpecGameIds;
 }
@@ -119,13 +151,14 @@ QList<QUuid> Worker::getPlaylistSpecificGameIds(const QList<Fp::Playlist>& playl
 Worker::Result Worker::processPlatformGames(Qx::Error& errorReport, std::unique_ptr<Lr::IPlatformDoc>& platformDoc, const PlatformQueryResult& gameQueryResult)
 {
     Fp::Db* db = mFlashpointInstall->database();
+    bool needTags = mLauncherInstall->usesGameTags();
 
     // Add/Update games
     for(const auto& game : gameQueryResult.result)
     {
-        // Get tags
+        // Get tags, skipping the query entirely for launchers that don't use them
         Fp::GameTags gameTags;
-        if(auto dbErr = db->getGameTags(gameTags, game.id()); dbErr.isValid())
+        if(auto dbErr = needTags ? db->getGameTags(gameTags, game.id()) : Fp::DbError(); dbErr.isValid())
         {
             errorReport = Qx::Error();
             return Failed;
@@ -215,8 +248,17 @@ Worker::Result Worker::processGames(Qx::Error& errorReport, QList<PlatformQueryR
     auto platformsHandler = [&remainingPlatforms, &errorReport, this](const QList<PlatformQueryResult>& platformQueryResults, QString label) -> Result {
         Result result;
 
-        for(const auto& pfQuery : platformQueryResults)
+        for(qsizetype i = 0; i < platformQueryResults.size(); i++)
         {
+            const PlatformQueryResult& pfQuery = platformQueryResults[i];
+
+            /* Start reading the next few docs in the background. Limited to the current list since
+             * the same platform can appear in both, in which case the later checkout must see
+             * what this one commits.
+             */
+            for(qsizetype p = i + 1; p < platformQueryResults.size() && p <= i + PLATFORM_PREFETCH_DEPTH; p++)
+                mLauncherInstall->prefetchPlatformDoc(platformQueryResults[p].platform);
+
             // Open launcher platform doc
             std::unique_ptr<Lr::IPlatformDoc> currentPlatformDoc;
             Lr::DocHandlingError platformReadError = mLauncherInstall->checkoutPlatformDoc(currentPlatformDoc, pfQuery.platform);
@@ -255,11 +297,17 @@ Worker::Result Worker::processGames(Qx::Error& errorReport, QList<PlatformQueryR
 
     // Import primary platforms
     if((platformImportStatus = platformsHandler(primary, STEP_IMPORTING_PLATFORM_SETS)) != Successful)
+    {
+        mLauncherInstall->discardPrefetchedDocs();
         return platformImportStatus;
+    }
 
     // Import playlist specific platforms
     if((platformImportStatus = platformsHandler(playlistSpecific, STEP_IMPORTING_PLAYLIST_SPEC_SETS)) != Successful)
+    {
+        mLauncherInstall->discardPrefetchedDocs();
         return platformImportStatus;
+    }
 
     // Return success
     errorReport = Qx::Error();
@@ -518,7 +566,8 @@ Worker::Result Worker::doImport(Qx::Error& errorReport)
         .clifpPath = CLIFp::standardCLIFpPath(*mFlashpointInstall),
         .involvedPlatforms = involvedPlatforms,
         .involvedPlaylists = mImportSelections.playlists,
-        .forceFullscreen = mOptionSet.forceFullscreen
+        .forceFullscreen = mOptionSet.forceFullscreen,
+        .clifpParameters = CLIFp::ParametersTemplate(mOptionSet.forceFullscreen)
     };
     Details::setCurrent(details);
 
@@ -58,6 +58,9 @@ private:
     static inline const QString STEP_IMPORTING_PLAYLISTS = u"Importing playlist %1..."_s;
     static inline const QString STEP_FINALIZING = u"Finalizing..."_s;
 
+    // Platform docs to read ahead while the current one is processed
+    static const qsizetype PLATFORM_PREFETCH_DEPTH = 2;
+
 //-Instance Variables--------------------------------------------------------------------------------------------
 private:
     // Install links
@@ -6,6 +6,10 @@
 #include <qx/windows/qx-filedetails.h>
 #endif
 
+// Qt Includes
+#include <QSaveFile>
+#include <QCryptographicHash>
+
 // libfp Includes
 #include <fp/fp-install.h>
 
@@ -18,6 +22,29 @@
 //===============================================================================================================
 
 //-Class Functions--------------------------------------------------------------------------------------------
+//Private:
+QByteArray CLIFp::internalHash()
+{
+    static QByteArray h = []{
+        QFile internalCLIFp(INTERNAL_PATH);
+        QCryptographicHash hash(QCryptographicHash::Sha256);
+        return internalCLIFp.open(QIODevice::ReadOnly) && hash.addData(&internalCLIFp) ? hash.result() : QByteArray();
+    }();
+    return h;
+}
+
+bool CLIFp::installedMatchesInternal(const Fp::Install& fpInstall)
+{
+    // Compare size first since that catches nearly every different build without reading anything
+    QFile clifp(standardCLIFpPath(fpInstall));
+    if(!clifp.open(QIODevice::ReadOnly) || clifp.size() != QFile(INTERNAL_PATH).size())
+        return false;
+
+    QByteArray ih = internalHash();
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    return !ih.isEmpty() && hash.addData(&clifp) && hash.result() == ih;
+}
+
 //Public:
 Qx::VersionNumber CLIFp::internalVersion()
 {
@@ -55,28 +82,27 @@ bool CLIFp::hasCLIFp(const Fp::Install& fpInstall)
 
 bool CLIFp::deployCLIFp(QString& errorMsg, const Fp::Install& fpInstall)
 {
-    // Delete existing if present
-    QFile clifp(standardCLIFpPath(fpInstall));
-    QFileInfo fileInfo(clifp);
-    if(fileInfo.exists() && fileInfo.isFile())
+    // Skip if the exact same build is already deployed, which is the case after nearly every import
+    if(installedMatchesInternal(fpInstall))
+        return true;
+
+    QFile internalCLIFp(INTERNAL_PATH);
+    if(!internalCLIFp.open(QIODevice::ReadOnly))
     {
-        if(!clifp.remove())
-        {
-            errorMsg = clifp.errorString();
-            return false;
-        }
+        errorMsg = internalCLIFp.errorString();
+        return false;
     }
 
-    // Deploy new
-    QFile internalCLIFp(u":/file/clifp"_s);
-    if(!internalCLIFp.copy(clifp.fileName()))
+    // Deploy new, replacing any existing one atomically so that a failure never leaves a partial copy behind
+    QSaveFile clifp(standardCLIFpPath(fpInstall));
+    if(!clifp.open(QIODevice::WriteOnly) || clifp.write(internalCLIFp.readAll()) != internalCLIFp.size() || !clifp.commit())
     {
-        errorMsg = internalCLIFp.errorString();
+        errorMsg = clifp.errorString();
         return false;
     }
 
     // Remove default read-only state
-    clifp.setPermissions(QFile::ReadOther | QFile::WriteOther);
+    QFile::setPermissions(clifp.fileName(), QFile::ReadOther | QFile::WriteOther);
 
     // Return true on
     return true;
@@ -84,11 +110,33 @@ bool CLIFp::deployCLIFp(QString& errorMsg, const Fp::Install& fpInstall)
 
 QString CLIFp::parametersFromStandard(const QUuid& titleId) { return parametersFromStandard(titleId.toString(QUuid::WithoutBraces)); }
 
-QString CLIFp::parametersFromStandard(const QString& titleId)
+QString CLIFp::parametersFromStandard(const QString& titleId) { return Import::Details::current().clifpParameters.fill(titleId); }
+
+//===============================================================================================================
+// CLIFp::ParametersTemplate
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------
+//Public:
+CLIFp::ParametersTemplate::ParametersTemplate(bool fullscreen)
 {
-    QString params = u"-q "_s + PLAY_COMMAND + ' ' + ID_ARG.arg(titleId);
-    auto impDet = Import::Details::current();
-    if(impDet.forceFullscreen)
+    // Split the standard parameters around the ID
+    QString params = u"-q "_s + PLAY_COMMAND + ' ' + ID_ARG;
+    if(fullscreen)
         params += ' ' + FULLSCREEN_SWITCH;
+
+    qsizetype idPos = params.indexOf(u"%1"_s);
+    Q_ASSERT(idPos != -1);
+    mPrefix = params.first(idPos);
+    mSuffix = params.sliced(idPos + 2);
+}
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Public:
+QString CLIFp::ParametersTemplate::fill(QStringView titleId) const
+{
+    QString params;
+    params.reserve(mPrefix.size() + titleId.size() + mSuffix.size());
+    params.append(mPrefix).append(titleId).append(mSuffix);
     return params;
 }
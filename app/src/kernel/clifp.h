@@ -12,6 +12,10 @@
 
 class CLIFp
 {
+// Inner classes
+public:
+    class ParametersTemplate;
+
 // Class members
 public:
     static inline const QString NAME = u"CLIFp"_s;
@@ -29,6 +33,7 @@ public:
     // static inline const QString MSG_ARG = uR"(--msg="%1")"_s;
     // static inline const QString EXTRA_ARG = uR"(--extra="%1")"_s;
     static inline const QString FULLSCREEN_SWITCH = uR"(--fullscreen)"_s;
+    static inline const QString INTERNAL_PATH = u":/file/clifp"_s;
 
     static inline const QString ERR_FP_CANT_DEPLOY_CLIFP = u"Failed to deploy "_s + EXE_NAME + u" to the selected Flashpoint install.\n"_s
                                                            "\n"
@@ -37,6 +42,10 @@ public:
                                                            "If you choose to ignore this you will have to place CLIFp in your Flashpoint install directory manually.";
 
 // Class functions
+private:
+    static QByteArray internalHash();
+    static bool installedMatchesInternal(const Fp::Install& fpInstall);
+
 public:
     static Qx::VersionNumber internalVersion();
     static Qx::VersionNumber installedVersion(const Fp::Install& fpInstall);
@@ -48,4 +57,23 @@ public:
     static QString parametersFromStandard(const QString& titleId);
 };
 
+/* The standard parameters with everything but the title ID already laid out, so that they can be produced for each
+ * title of an import with a single allocation and no formatting
+ */
+class CLIFp::ParametersTemplate
+{
+// Instance members
+private:
+    QString mPrefix;
+    QString mSuffix;
+
+// Constructor
+public:
+    explicit ParametersTemplate(bool fullscreen = false);
+
+// Instance functions
+public:
+    QString fill(QStringView titleId) const;
+};
+
 #endif // CLIFP_H
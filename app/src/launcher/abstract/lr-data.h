@@ -1,9 +1,18 @@
 #ifndef LR_DATA_H
 #define LR_DATA_H
 
+// Standard Library Includes
+#include <optional>
+
+// Qt Includes
+#include <QBuffer>
+#include <QCryptographicHash>
+
 // Project Includes
 #include "launcher/interface/lr-data-interface.h"
 #include "launcher/abstract/lr-registration.h"
+#include "launcher/abstract/lr-snapshot.h"
+#include "import/stringpool.h"
 
 /* NOTE: These classes are convenience versions of the ones in the 'interface' folder that are templated
  * so that some of the types involved will be the launcher specific versions instead of a generic base
@@ -237,6 +246,38 @@ public:
     using IDataDoc::preCommit; // Does nothing by default
 };
 
+template<class Builder>
+class ElementDispatch
+{
+    /* Maps child element names to the builder field they populate so that readers can look up the handler
+     * for an element in one step instead of comparing its name against every known element in turn. Instances
+     * are intended to be static and built from the namespace scope element name constants, which the keys view.
+     */
+//-Aliases------------------------------------------------------------------------------------------------------------
+public:
+    using Handler = void (*)(Builder& builder, QXmlStreamReader& reader);
+
+//-Inner Classes------------------------------------------------------------------------------------------------------
+public:
+    struct Entry
+    {
+        QStringView element;
+        Handler handler;
+    };
+
+//-Instance Variables--------------------------------------------------------------------------------------------------
+private:
+    QHash<QStringView, Handler> mHandlers;
+
+//-Constructor--------------------------------------------------------------------------------------------------------
+public:
+    ElementDispatch(std::initializer_list<Entry> entries);
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+public:
+    Handler handler(QStringView element) const;
+};
+
 template<class DocT>
 class XmlDocReader : public DataDocReader<DocT>
 {
@@ -248,6 +289,13 @@ protected:
     QXmlStreamReader mStreamReader;
     QString mRootElement;
 
+private:
+    bool mRetainRawData;
+    QByteArray mRawData;
+    QBuffer mRawBuffer;
+    qint64 mCharCursor;
+    qint64 mByteCursor;
+
 //-Constructor--------------------------------------------------------------------------------------------------------
 public:
     XmlDocReader(DocT* targetDoc, const QString& root = {});
@@ -257,9 +305,27 @@ private:
     // IMPLEMENT
     virtual DocHandlingError readTargetDoc() = 0;
 
+    qint64 byteOffset();
+
 protected:
     DocHandlingError streamStatus() const;
 
+    /* Reads the whole file into memory up front and parses from there, so that the doc can share the exact bytes
+     * that were parsed. Off by default, in which case the file is streamed and rawData() is empty.
+     */
+    void setRetainRawData(bool retain);
+    const QByteArray& rawData() const;
+
+    // Elements not in the dispatch table are stored as "other fields"
+    template<class Builder>
+    void readChildElements(Builder& builder, const ElementDispatch<Builder>& dispatch);
+
+    /* Elements not in the dispatch table are instead left in the element's original markup, taken from 'source',
+     * which must be rawData() (shared by the target doc). Falls back to the above if that's not possible.
+     */
+    template<class Builder>
+    void readChildElements(Builder& builder, const ElementDispatch<Builder>& dispatch, const QByteArray& source);
+
 public:
     DocHandlingError readInto() override;
 };
@@ -269,23 +335,76 @@ class XmlDocWriter : public DataDocWriter<DocT>
 {
 protected:
     using DataDocWriter<DocT>::source;
+//-Structs------------------------------------------------------------------------------------------------------------
+protected:
+    struct Span
+    {
+        qint64 offset;
+        qint64 length;
+    };
+
+//-Class Variables----------------------------------------------------------------------------------------------------
+private:
+    // The document is built in memory and written out in chunks of at least this size
+    static const qint64 FLUSH_THRESHOLD = 4 * 1024 * 1024;
+
 //-Instance Variables--------------------------------------------------------------------------------------------------
 protected:
     QFile mXmlFile;
+    QBuffer mBuffer;
     QXmlStreamWriter mStreamWriter;
     QString mRootElement;
+    bool mFormatted;
+
+private:
+    bool mAfterOriginal;
+
+    // Span tracking
+    bool mTrackSpans;
+    qint64 mItemStart;
+    QHash<const Item*, Span> mSpans;
+    QCryptographicHash mOutputHash;
 
 //-Constructor--------------------------------------------------------------------------------------------------------
 public:
     XmlDocWriter(DocT* sourceDoc, const QString& root = {});
 
+//-Class Functions----------------------------------------------------------------------------------------------------
+private:
+    static bool needsSanitizing(QStringView text);
+
 //-Instance Functions-------------------------------------------------------------------------------------------------
+private:
+    bool flush();
+    qint64 outputPos() const;
+    void writeOriginalIndent();
+
 protected:
+    void setFormatted(bool formatted); // Indents the output, on by default
     void writeCleanTextElement(const QString& qualifiedName, const QString& text);
     void writeCleanTextElement(const QString& qualifiedName, const QString& text, const QXmlStreamAttributes& attributes);
     void writeOtherFields(const Item& item);
+
+    // Also writes any other fields still in the item's original markup, which are those not in 'known'
+    template<class Builder>
+    void writeOtherFields(const Item& item, const ElementDispatch<Builder>& known);
+
+    /* Copies unmodified items out verbatim in place of re-writing them. Returns false for any other item, which the
+     * caller must then write itself, immediately (i.e. 'writeOriginal(item) || writeItem(item)').
+     */
+    bool writeOriginal(const Item& item);
     DocHandlingError streamStatus() const;
 
+    /* Records where each item ends up in the output, along with a hash of the whole output, for writers that keep a
+     * DocSnapshot of what they write. Items written directly must be bracketed with beginItem()/endItem(), the former
+     * called right after the item's start element is written and the latter right after its end element.
+     */
+    void setSpanTracking(bool track);
+    void beginItem(const QString& elementName);
+    void endItem(const Item& item);
+    std::optional<Span> itemSpan(const Item& item) const;
+    QByteArray outputHash() const;
+
     // IMPLEMENT
     virtual bool writeSourceDoc() = 0;
 
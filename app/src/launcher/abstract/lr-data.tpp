@@ -189,7 +189,7 @@ void BasicPlaylistDoc<Id>::setPlaylistData(const Fp::Playlist& playlist)
     lrPlaylistHeader.copyOtherFields(mPlaylistHeader);
 
     // Set instance header to new one
-    mPlaylistHeader = lrPlaylistHeader;
+    mPlaylistHeader = std::move(lrPlaylistHeader);
 
     for(const auto& plg : playlist.playlistGames())
     {
@@ -208,6 +208,25 @@ bool BasicPlaylistDoc<Id>::isEmpty() const
     return mPlaylistGames.isEmpty();
 }
 
+//===============================================================================================================
+// ElementDispatch
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------------
+//Public:
+template<class Builder>
+ElementDispatch<Builder>::ElementDispatch(std::initializer_list<Entry> entries)
+{
+    mHandlers.reserve(entries.size());
+    for(const Entry& e : entries)
+        mHandlers.insert(e.element, e.handler);
+}
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+//Public:
+template<class Builder>
+ElementDispatch<Builder>::Handler ElementDispatch<Builder>::handler(QStringView element) const { return mHandlers.value(element, nullptr); }
+
 //===============================================================================================================
 // XmlDocReader
 //===============================================================================================================
@@ -218,11 +237,36 @@ template<class DocT>
 XmlDocReader<DocT>::XmlDocReader(DocT* targetDoc, const QString& root) :
     DataDocReader<DocT>(targetDoc),
     mXmlFile(targetDoc->path()),
-    mStreamReader(&mXmlFile),
-    mRootElement(root)
+    mStreamReader(),
+    mRootElement(root),
+    mRetainRawData(false),
+    mCharCursor(0),
+    mByteCursor(0)
 {}
 
 //-Instance Functions-------------------------------------------------------------------------------------------------
+//Private:
+template<class DocT>
+qint64 XmlDocReader<DocT>::byteOffset()
+{
+    /* The stream reader reports its position in UTF-16 code units, so walk the UTF-8 input forward to the same
+     * point. Positions only ever increase, so the walk is spread out over the whole read. Returns -1 if the
+     * position can't be determined.
+     */
+    qint64 target = mStreamReader.characterOffset();
+    if(mRawData.isEmpty() || target < mCharCursor)
+        return -1;
+
+    while(mCharCursor < target && mByteCursor < mRawData.size())
+    {
+        uchar lead = static_cast<uchar>(mRawData.at(mByteCursor));
+        mByteCursor += lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+        mCharCursor += lead < 0xF0 ? 1 : 2; // Surrogate pair
+    }
+
+    return mCharCursor == target && mByteCursor <= mRawData.size() ? mByteCursor : -1;
+}
+
 //Protected:
 template<class DocT>
 DocHandlingError XmlDocReader<DocT>::streamStatus() const
@@ -236,6 +280,64 @@ DocHandlingError XmlDocReader<DocT>::streamStatus() const
     return DocHandlingError();
 }
 
+template<class DocT>
+void XmlDocReader<DocT>::setRetainRawData(bool retain) { mRetainRawData = retain; }
+
+template<class DocT>
+const QByteArray& XmlDocReader<DocT>::rawData() const { return mRawData; }
+
+template<class DocT>
+template<class Builder>
+void XmlDocReader<DocT>::readChildElements(Builder& builder, const ElementDispatch<Builder>& dispatch)
+{
+    // Cover all children
+    while(mStreamReader.readNextStartElement())
+    {
+        if(auto handler = dispatch.handler(mStreamReader.name()))
+            handler(builder, mStreamReader);
+        else
+            builder.wOtherField({Import::StringPool::intern(mStreamReader.name()), mStreamReader.readElementText()});
+    }
+}
+
+template<class DocT>
+template<class Builder>
+void XmlDocReader<DocT>::readChildElements(Builder& builder, const ElementDispatch<Builder>& dispatch, const QByteArray& source)
+{
+    Q_ASSERT(source.isEmpty() || source.size() == mRawData.size());
+
+    // Locate the start tag, which must be plain (i.e. no attributes) so that its length is known
+    QByteArray startTag = '<' + mStreamReader.name().toUtf8() + '>';
+    qint64 start = !source.isEmpty() ? byteOffset() : -1;
+    start = start >= startTag.size() ? start - startTag.size() : -1;
+    if(start < 0 || !QByteArrayView(source).sliced(start).startsWith(startTag))
+    {
+        readChildElements(builder, dispatch);
+        return;
+    }
+
+    // Cover all children, only reading the known ones
+    while(mStreamReader.readNextStartElement())
+    {
+        if(auto handler = dispatch.handler(mStreamReader.name()))
+            handler(builder, mStreamReader);
+        else
+            mStreamReader.skipCurrentElement();
+    }
+
+    // Locate the end tag, searching for it if the reported position doesn't line up for whatever reason
+    QByteArray endTag = "</" + mStreamReader.name().toUtf8();
+    qint64 end = byteOffset();
+    if(end < 0 || !QByteArrayView(source).first(end).endsWith(endTag + '>'))
+    {
+        qint64 endTagStart = source.indexOf(endTag + '>', start);
+        end = endTagStart != -1 ? source.indexOf('>', endTagStart) + 1 : 0;
+    }
+
+    if(end > start)
+        builder.wOriginalMarkup(QByteArrayView(source).sliced(start, end - start));
+}
+
 //Public:
 template<class DocT>
 DocHandlingError XmlDocReader<DocT>::readInto()
@@ -244,6 +346,28 @@ DocHandlingError XmlDocReader<DocT>::readInto()
     if(!mXmlFile.open(QFile::ReadOnly))
         return DocHandlingError(*target(), DocHandlingError::DocCantOpen, mXmlFile.errorString());
 
+    /* When the raw data is kept, the file is read exactly once into a single buffer that is then parsed through a
+     * device, so that the stream reader still decodes it in chunks and treats the end of the data as the end of
+     * the document. The doc can share the buffer without copying it.
+     */
+    if(mRetainRawData)
+    {
+        mRawData = mXmlFile.readAll();
+        if(mXmlFile.error() != QFileDevice::NoError)
+            return DocHandlingError(*target(), DocHandlingError::DocReadFailed, mXmlFile.errorString());
+        mXmlFile.close();
+
+        mRawBuffer.setBuffer(&mRawData);
+        mRawBuffer.open(QIODevice::ReadOnly);
+        mStreamReader.setDevice(&mRawBuffer);
+
+        // A UTF-8 BOM isn't counted as a character
+        if(mRawData.startsWith("\xEF\xBB\xBF"))
+            mByteCursor = 3;
+    }
+    else
+        mStreamReader.setDevice(&mXmlFile);
+
     if(!mRootElement.isEmpty())
     {
         if(!mStreamReader.readNextStartElement())
@@ -271,19 +395,86 @@ template<class DocT>
 XmlDocWriter<DocT>::XmlDocWriter(DocT* sourceDoc, const QString& root) :
     DataDocWriter<DocT>(sourceDoc),
     mXmlFile(sourceDoc->path()),
-    mStreamWriter(&mXmlFile),
-    mRootElement(root)
+    mBuffer(),
+    mStreamWriter(&mBuffer),
+    mRootElement(root),
+    mFormatted(true),
+    mAfterOriginal(false),
+    mTrackSpans(false),
+    mItemStart(-1),
+    mOutputHash(DocSnapshot::HASH_ALGORITHM)
 {}
 
+//-Class Functions----------------------------------------------------------------------------------------------------
+//Private:
+template<class DocT>
+bool XmlDocWriter<DocT>::needsSanitizing(QStringView text)
+{
+    /* Checks for the characters that aren't allowed in XML 1.0 (control characters and non-characters), plus
+     * surrogates so that the full sanitizer always handles those. Written without early exits so that the compiler
+     * can vectorize it, since the vast majority of text needs no sanitizing at all.
+     */
+    bool flagged = false;
+    for(QChar c : text)
+    {
+        char16_t u = c.unicode();
+        flagged |= (u < 0x20) & (u != u'\t') & (u != u'\n') & (u != u'\r');
+        flagged |= (u >= 0xD800) & (u <= 0xDFFF);
+        flagged |= u >= 0xFFFE;
+    }
+
+    return flagged;
+}
+
 //-Instance Functions-------------------------------------------------------------------------------------------------
+//Private:
+template<class DocT>
+bool XmlDocWriter<DocT>::flush()
+{
+    QByteArray& data = mBuffer.buffer();
+    if(data.isEmpty())
+        return true;
+
+    bool written = mXmlFile.write(data) == data.size();
+    if(mTrackSpans)
+        mOutputHash.addData(data);
+
+    // Reuse allocation
+    data.resize(0);
+    mBuffer.seek(0);
+
+    return written;
+}
+
+template<class DocT>
+qint64 XmlDocWriter<DocT>::outputPos() const { return mXmlFile.pos() + mBuffer.pos(); }
+
+template<class DocT>
+void XmlDocWriter<DocT>::writeOriginalIndent()
+{
+    /* Starts a new line at the depth of the root's children. Needed before each original, and before the next
+     * element the stream writer writes after one, since it thinks the last thing written was text and so doesn't
+     * put that element on its own line.
+     */
+    if(mFormatted)
+        mBuffer.write('\n' + QByteArray(mRootElement.isEmpty() ? 0 : 2, ' '));
+}
+
 //Protected:
+template<class DocT>
+void XmlDocWriter<DocT>::setFormatted(bool formatted) { mFormatted = formatted; }
+
 template<class DocT>
 void XmlDocWriter<DocT>::writeCleanTextElement(const QString& qualifiedName, const QString& text)
 {
     if(text.isEmpty())
         mStreamWriter.writeEmptyElement(qualifiedName);
     else
-        mStreamWriter.writeTextElement(qualifiedName, Qx::xmlSanitized(text));
+        mStreamWriter.writeTextElement(qualifiedName, needsSanitizing(text) ? Qx::xmlSanitized(text) : text);
+
+    // Write out buffer if it's grown large enough (errors are picked up through the file's state)
+    if(mBuffer.size() >= FLUSH_THRESHOLD)
+        flush();
 }
 
 template<class DocT>
@@ -303,13 +494,111 @@ void XmlDocWriter<DocT>::writeOtherFields(const Item& item)
         writeCleanTextElement(of.key, of.value);
 }
 
+template<class DocT>
+template<class Builder>
+void XmlDocWriter<DocT>::writeOtherFields(const Item& item, const ElementDispatch<Builder>& known)
+{
+    writeOtherFields(item);
+
+    if(!item.hasDeferredOtherFields())
+        return;
+
+    // Pick the other fields out of the original markup
+    QByteArrayView markup = item.originalMarkup();
+    QXmlStreamReader originalReader(QByteArray::fromRawData(markup.data(), markup.size()));
+    if(!originalReader.readNextStartElement())
+        return;
+
+    while(originalReader.readNextStartElement())
+    {
+        if(known.handler(originalReader.name()))
+            originalReader.skipCurrentElement();
+        else
+            writeCleanTextElement(originalReader.name().toString(), originalReader.readElementText());
+    }
+}
+
+template<class DocT>
+bool XmlDocWriter<DocT>::writeOriginal(const Item& item)
+{
+    if(!item.isUnmodifiedOriginal())
+    {
+        // The caller writes this one through the stream writer next, so put it on its own line
+        if(mAfterOriginal)
+        {
+            writeOriginalIndent();
+            mAfterOriginal = false;
+        }
+        return false;
+    }
+
+    /* Writing straight into the buffer behind the stream writer's back is safe because the stream writer doesn't
+     * buffer anything itself: every call is encoded and written to the device (as UTF-8, same as the original markup)
+     * before it returns, so the raw bytes land exactly between what it wrote before and after. The one exception is
+     * the closing '>' of a start tag, which it holds back in case the element ends up empty; writing empty characters
+     * forces that out. The only other state it keeps is for formatting, which is why the indentation around the raw
+     * markup is handled here instead (see writeOriginalIndent()). Flushing and span tracking see the raw bytes like
+     * any others since they work off the buffer.
+     */
+    mStreamWriter.writeCharacters(QString());
+    writeOriginalIndent();
+
+    QByteArrayView original = item.originalMarkup();
+    if(mTrackSpans)
+        mSpans.insert(&item, Span{.offset = outputPos(), .length = original.size()});
+    mBuffer.write(original.data(), original.size());
+    mAfterOriginal = true;
+
+    if(mBuffer.size() >= FLUSH_THRESHOLD)
+        flush();
+
+    return true;
+}
+
 template<class DocT>
 DocHandlingError XmlDocWriter<DocT>::streamStatus() const
 {
+    if(mXmlFile.error() != QFileDevice::NoError)
+        return DocHandlingError(*source(), DocHandlingError::DocWriteFailed, mXmlFile.errorString());
+
     return mStreamWriter.hasError() ? DocHandlingError(*source(), DocHandlingError::DocWriteFailed, mStreamWriter.device()->errorString()) :
                DocHandlingError();
 }
 
+template<class DocT>
+void XmlDocWriter<DocT>::setSpanTracking(bool track) { mTrackSpans = track; }
+
+template<class DocT>
+void XmlDocWriter<DocT>::beginItem(const QString& elementName)
+{
+    if(!mTrackSpans)
+        return;
+
+    // The start element's closing '>' isn't written until the stream writer moves on, so the output ends with '<name'
+    mItemStart = outputPos() - (1 + elementName.toUtf8().size());
+}
+
+template<class DocT>
+void XmlDocWriter<DocT>::endItem(const Item& item)
+{
+    if(!mTrackSpans)
+        return;
+
+    Q_ASSERT(mItemStart >= 0);
+    mSpans.insert(&item, Span{.offset = mItemStart, .length = outputPos() - mItemStart});
+    mItemStart = -1;
+}
+
+template<class DocT>
+std::optional<typename XmlDocWriter<DocT>::Span> XmlDocWriter<DocT>::itemSpan(const Item& item) const
+{
+    auto itr = mSpans.constFind(&item);
+    return itr != mSpans.cend() ? std::optional<Span>(*itr) : std::nullopt;
+}
+
+template<class DocT>
+QByteArray XmlDocWriter<DocT>::outputHash() const { return mOutputHash.result(); }
+
 //Public:
 template<class DocT>
 DocHandlingError XmlDocWriter<DocT>::writeOutOf()
@@ -322,8 +611,12 @@ DocHandlingError XmlDocWriter<DocT>::writeOutOf()
     if(!mXmlFile.open(QFile::WriteOnly | QFile::Truncate)) // Discard previous contents
         return DocHandlingError(*source(), DocHandlingError::DocCantSave, mXmlFile.errorString());
 
-    // Enable auto formatting
-    mStreamWriter.setAutoFormatting(true);
+    // Prepare in-memory buffer
+    mBuffer.buffer().reserve(FLUSH_THRESHOLD + FLUSH_THRESHOLD / 4); // Room for overshoot before a flush
+    mBuffer.open(QIODevice::WriteOnly);
+
+    // Set auto formatting
+    mStreamWriter.setAutoFormatting(mFormatted);
     mStreamWriter.setAutoFormattingIndent(2);
 
     // Write standard XML header
@@ -337,13 +630,18 @@ DocHandlingError XmlDocWriter<DocT>::writeOutOf()
     if(!writeSourceDoc())
         return streamStatus();
 
-    // Close main element (if present)
+    // Close main element (if present), on its own line even if original markup was written last
+    if(mAfterOriginal && mFormatted)
+        mBuffer.write("\n");
     if(!mRootElement.isEmpty())
         mStreamWriter.writeEndElement();
 
     // Finish document
     mStreamWriter.writeEndDocument();
 
+    // Write out remainder
+    flush();
+
     // Return null string on success
     return streamStatus();
 
@@ -45,6 +45,7 @@ protected:
 public:
     QString name() const override;
 
+    void prefetchPlatformDoc(const QString& name) override;
     DocHandlingError checkoutPlatformDoc(std::unique_ptr<IPlatformDoc>& returnBuffer, const QString& name) override;
     DocHandlingError checkoutPlaylistDoc(std::unique_ptr<IPlaylistDoc>& returnBuffer, const QString& name) override;
     DocHandlingError commitPlatformDoc(std::unique_ptr<IPlatformDoc> platformDoc) override;
@@ -49,11 +49,42 @@ void Install<Id>::preparePlaylistDocCommit(const PlaylistT& document)
 template<LauncherId Id>
 QString Install<Id>::name() const { return StaticRegistry<Id>::name().toString(); }
 
+template<LauncherId Id>
+void Install<Id>::prefetchPlatformDoc(const QString& name)
+{
+    // Nothing to do ahead of time if platform docs are never read
+    if constexpr(HasPlatformReader<Id>)
+    {
+        QString translatedName = translatedDocName(name, IDataDoc::Type::Platform);
+        if(!canPrefetchDataDocument(IDataDoc::Identifier(IDataDoc::Type::Platform, translatedName)))
+            return;
+
+        // Start reading into a blank doc in the background
+        std::unique_ptr<PlatformT> platformDoc = preparePlatformDocCheckout(translatedName);
+        std::shared_ptr<IPlatformDoc::Reader> docReader = std::make_shared<PlatformReaderT>(platformDoc.get());
+        prefetchDataDocument(std::move(platformDoc), std::move(docReader));
+    }
+    else
+        Q_UNUSED(name);
+}
+
 template<LauncherId Id>
 DocHandlingError Install<Id>::checkoutPlatformDoc(std::unique_ptr<IPlatformDoc>& returnBuffer, const QString& name)
 {
     // Translate to launcher doc name
-    QString translatedName = translateDocName(name, IDataDoc::Type::Platform);
+    QString translatedName = translatedDocName(name, IDataDoc::Type::Platform);
+
+    // Use prefetched doc if available
+    IDataDoc::Identifier docId(IDataDoc::Type::Platform, translatedName);
+    if(isPrefetched(docId))
+    {
+        std::unique_ptr<IDataDoc> prefetchedDoc;
+        DocHandlingError readErrorStatus = claimPrefetchedDataDocument(prefetchedDoc, docId);
+        if(!readErrorStatus.isValid())
+            returnBuffer.reset(static_cast<PlatformT*>(prefetchedDoc.release()));
+
+        return readErrorStatus;
+    }
 
     // Get initialized blank doc and create reader if present
     std::unique_ptr<PlatformT> platformDoc = preparePlatformDocCheckout(translatedName);
@@ -76,7 +107,7 @@ template<LauncherId Id>
 DocHandlingError Install<Id>::checkoutPlaylistDoc(std::unique_ptr<IPlaylistDoc>& returnBuffer, const QString& name)
 {
     // Translate to launcher doc name
-    QString translatedName = translateDocName(name, IDataDoc::Type::Playlist);
+    QString translatedName = translatedDocName(name, IDataDoc::Type::Playlist);
 
     // Get initialized blank doc and create reader if present
     std::unique_ptr<PlaylistT> playlistDoc = preparePlaylistDocCheckout(translatedName);
@@ -0,0 +1,81 @@
+// Unit Include
+#include "lr-snapshot.h"
+
+// Qt Includes
+#include <QFileInfo>
+
+namespace Lr
+{
+//===============================================================================================================
+// DocSnapshot
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------------
+//Public:
+DocSnapshot::DocSnapshot(const QString& docPath) :
+    mDocPath(docPath),
+    mSnapshotPath(docPath + '.' + EXT)
+{}
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+//Public:
+QString DocSnapshot::path() const { return mSnapshotPath; }
+QDataStream& DocSnapshot::stream() { return mStream; }
+
+bool DocSnapshot::load(quint16 contentVersion, QByteArray& docData)
+{
+    mSnapshotFile.setFileName(mSnapshotPath);
+    if(!mSnapshotFile.open(QIODevice::ReadOnly))
+        return false;
+
+    mStream.setDevice(&mSnapshotFile);
+    mStream.setVersion(QDataStream::Qt_6_0);
+
+    QByteArray magic;
+    quint16 formatVersion;
+    quint16 snapshotContentVersion;
+    qint64 docSize;
+    qint64 docModified;
+    QByteArray docHash;
+    mStream >> magic >> formatVersion >> snapshotContentVersion >> docSize >> docModified >> docHash;
+    if(mStream.status() != QDataStream::Ok || magic != MAGIC || formatVersion != FORMAT_VERSION || snapshotContentVersion != contentVersion)
+        return false;
+
+    // Cheap checks first
+    QFileInfo docInfo(mDocPath);
+    if(!docInfo.exists() || docInfo.size() != docSize || docInfo.lastModified().toMSecsSinceEpoch() != docModified)
+        return false;
+
+    // Then make sure the content is really the same
+    QFile docFile(mDocPath);
+    if(!docFile.open(QIODevice::ReadOnly))
+        return false;
+
+    QByteArray data = docFile.readAll();
+    if(data.size() != docSize || QCryptographicHash::hash(data, HASH_ALGORITHM) != docHash)
+        return false;
+
+    docData = std::move(data);
+    return true;
+}
+
+bool DocSnapshot::begin(quint16 contentVersion, const QByteArray& docHash)
+{
+    QFileInfo docInfo(mDocPath);
+    if(!docInfo.exists())
+        return false;
+
+    mNewSnapshotFile.setFileName(mSnapshotPath);
+    if(!mNewSnapshotFile.open(QIODevice::WriteOnly))
+        return false;
+
+    mStream.setDevice(&mNewSnapshotFile);
+    mStream.setVersion(QDataStream::Qt_6_0);
+
+    mStream << MAGIC << FORMAT_VERSION << contentVersion << docInfo.size() << docInfo.lastModified().toMSecsSinceEpoch() << docHash;
+    return mStream.status() == QDataStream::Ok;
+}
+
+bool DocSnapshot::commit() { return mStream.status() == QDataStream::Ok && mNewSnapshotFile.commit(); }
+
+}
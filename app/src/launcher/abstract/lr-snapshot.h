@@ -0,0 +1,59 @@
+#ifndef LR_SNAPSHOT_H
+#define LR_SNAPSHOT_H
+
+// Qt Includes
+#include <QFile>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QCryptographicHash>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace Lr
+{
+
+/* Binary snapshot of a document's items as they were when FIL last wrote the document, kept beside it so that the
+ * next read can load the items straight from the snapshot instead of parsing the document again. It's only used
+ * while the document is byte for byte what was written (checked by size, modification time and a hash of its
+ * content), so that any edit made outside of FIL simply causes a normal read. The layout of the items is up to the
+ * user, which versions it separately.
+ */
+class DocSnapshot
+{
+//-Class Variables----------------------------------------------------------------------------------------------------
+public:
+    static inline const QString EXT = u"filsnap"_s;
+    static const QCryptographicHash::Algorithm HASH_ALGORITHM = QCryptographicHash::Md5;
+
+private:
+    static inline const QByteArray MAGIC = "FILSNAP"_ba;
+    static inline const quint16 FORMAT_VERSION = 1;
+
+//-Instance Variables-------------------------------------------------------------------------------------------------
+private:
+    QString mDocPath;
+    QString mSnapshotPath;
+    QFile mSnapshotFile;
+    QSaveFile mNewSnapshotFile;
+    QDataStream mStream;
+
+//-Constructor--------------------------------------------------------------------------------------------------------
+public:
+    explicit DocSnapshot(const QString& docPath);
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+public:
+    QString path() const;
+    QDataStream& stream();
+
+    // Reading, fills 'docData' with the document's content (which was needed for the check) if the snapshot is usable
+    bool load(quint16 contentVersion, QByteArray& docData);
+
+    // Writing, 'docHash' is of the document as it was just written and must use HASH_ALGORITHM
+    bool begin(quint16 contentVersion, const QByteArray& docHash);
+    bool commit();
+};
+
+}
+
+#endif // LR_SNAPSHOT_H
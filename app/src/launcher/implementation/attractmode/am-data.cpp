@@ -3,12 +3,18 @@
 
 // Qt Includes
 #include <QtDebug>
+#include <QFileInfo>
+#include <QDataStream>
+#include <QCryptographicHash>
+#include <QtEndian>
+#include <QtConcurrentMap>
 
 // Qx Includes
 #include <qx/core/qx-string.h>
 
 // Project Includes
 #include "launcher/implementation/attractmode/am-install.h"
+#include "import/backup.h"
 
 namespace Am
 {
@@ -48,8 +54,17 @@ bool Taglist::isEmpty() const
     return mTags.isEmpty();
 }
 
-bool Taglist::containsTag(QStringView tag) const { return mTags.contains(tag); }
-void Taglist::appendTag(const QString& tag) { mTags.append(tag); }
+bool Taglist::containsTag(const QUuid& tag) const { return mTagSet.contains(tag); }
+
+void Taglist::appendTag(const QUuid& tag)
+{
+    // Ignore duplicates, keeping the original order
+    if(!mTagSet.contains(tag))
+    {
+        mTagSet.insert(tag);
+        mTags.append(tag);
+    }
+}
 
 //===============================================================================================================
 // Taglist::Writer
@@ -66,8 +81,8 @@ Taglist::Writer::Writer(Taglist* sourceDoc) :
 bool Taglist::Writer::writeSourceDoc()
 {
     // Write tags
-    for(const QString& tag : std::as_const(source()->mTags))
-        mStreamWriter << tag << '\n';
+    for(const QUuid& tag : std::as_const(source()->mTags))
+        mStreamWriter << tag.toString(QUuid::WithoutBraces) << '\n';
 
     // Return error status
     return !mStreamWriter.hasError();
@@ -160,7 +175,11 @@ Lr::DocHandlingError Romlist::Reader::readTargetDoc()
     // Read all romlist entries
     while(!mStreamReader.atEnd())
     {
+        // Patched lists can end in commented out lines, which reads as an empty line at the end of the file
         QString rawEntry = readLineIgnoringComments();
+        if(rawEntry.isEmpty())
+            continue;
+
         parseRomEntry(rawEntry);
     }
 
@@ -170,36 +189,97 @@ Lr::DocHandlingError Romlist::Reader::readTargetDoc()
 
 void Romlist::Reader::parseRomEntry(const QString& rawEntry)
 {
-    // Prepare builder and iterator
+    // Prepare builder and view
     RomEntry::Builder reb;
-    QString::const_iterator itr = rawEntry.constBegin();
-    QString::const_iterator lastCharPos = rawEntry.constEnd() - 1;
-
-    // Parse support
+    QStringView entry(rawEntry);
+    const qsizetype end = entry.size();
+
+    /* Rather than walking the entry one character at a time, jump between the separators and quotes using
+     * indexOf() (which is vectorized) and slice fields out of the entry directly. A field is only copied
+     * into its own string when quotes split it into multiple pieces somewhere other than at its ends.
+     *
+     * The positions of the next separator and quote are cached, with 'end' meaning there are none left,
+     * so that each part of the entry is only searched once.
+     */
     bool inQuotes = false;
-    QString currentField;
     quint8 currentFieldIndex = 0;
+    qsizetype pos = 0;
+    qsizetype nextSeparator = -1;
+    qsizetype nextQuote = -1;
+
+    QStringView fieldPiece;
+    QString joinedField;
+    bool joined = false;
+
+    auto addPiece = [&](QStringView piece){
+        if(piece.isEmpty())
+            return;
+
+        if(!joined && fieldPiece.isEmpty())
+            fieldPiece = piece;
+        else if(!joined)
+        {
+            joinedField = fieldPiece.toString() + piece;
+            joined = true;
+        }
+        else
+            joinedField += piece;
+    };
+
+    auto finishField = [&]{
+        addFieldToBuilder(reb, joined ? QStringView(joinedField) : fieldPiece, currentFieldIndex++);
+        fieldPiece = {};
+        joinedField.clear();
+        joined = false;
+    };
+
+    auto advance = [&](qsizetype& cached, QChar c){
+        if(cached < pos)
+        {
+            cached = entry.indexOf(c, pos);
+            if(cached == -1)
+                cached = end;
+        }
+    };
 
     // Parse entry
-    while(itr != rawEntry.constEnd())
+    while(true)
     {
-        const QChar& c = *itr;
-        bool lastChar = itr == lastCharPos;
+        advance(nextQuote, u'"');
 
-        if(c == '"') // Quote change
-            inQuotes = !inQuotes;
+        if(inQuotes)
+        {
+            // Everything up to the closing quote is part of the field, separators included
+            addPiece(entry.sliced(pos, nextQuote - pos));
+            if(nextQuote == end)
+            {
+                finishField();
+                break;
+            }
+
+            inQuotes = false;
+            pos = nextQuote + 1;
+            continue;
+        }
 
-        if((c == ';' && !inQuotes) || lastChar) // Field separator
+        advance(nextSeparator, u';');
+
+        if(nextQuote < nextSeparator) // Quote change
         {
-            addFieldToBuilder(reb, currentField, currentFieldIndex);
-            currentField.clear();
-            currentFieldIndex++;
+            addPiece(entry.sliced(pos, nextQuote - pos));
+            inQuotes = true;
+            pos = nextQuote + 1;
+            continue;
         }
-        else if(c != '"')
-            currentField += c;
 
-        // Advance
-        itr++;
+        // Field separator, or end of entry
+        addPiece(entry.sliced(pos, nextSeparator - pos));
+        finishField();
+
+        // A separator at the very end doesn't start another field
+        pos = nextSeparator + 1;
+        if(pos >= end)
+            break;
     }
 
     // Ensure parsing ended out of quotes
@@ -207,75 +287,75 @@ void Romlist::Reader::parseRomEntry(const QString& rawEntry)
         qWarning("Missing terminating '\"' character for ROM entry %s", qPrintable(rawEntry));
 
     // Build Entry and add to document
-    target()->mEntries.insert(reb.build());
+    target()->mEntries.insert(std::move(reb).build());
 }
 
-void Romlist::Reader::addFieldToBuilder(RomEntry::Builder& builder, QString field, quint8 index)
+void Romlist::Reader::addFieldToBuilder(RomEntry::Builder& builder, QStringView field, quint8 index)
 {
     switch(index)
     {
         case 0:
-            builder.wName(field);
+            builder.wName(field.toString());
             break;
         case 1:
-            builder.wTitle(field);
+            builder.wTitle(field.toString());
             break;
         case 2:
-            builder.wEmulator(field);
+            builder.wEmulator(field.toString());
             break;
         case 3:
-            builder.wCloneOf(field);
+            builder.wCloneOf(field.toString());
             break;
         case 4:
-            builder.wYear(field);
+            builder.wYear(field.toString());
             break;
         case 5:
-            builder.wManufacturer(field);
+            builder.wManufacturer(field.toString());
             break;
         case 6:
-            builder.wCategory(field);
+            builder.wCategory(field.toString());
             break;
         case 7:
-            builder.wPlayers(field);
+            builder.wPlayers(field.toString());
             break;
         case 8:
-            builder.wRotation(field);
+            builder.wRotation(field.toString());
             break;
         case 9:
-            builder.wControl(field);
+            builder.wControl(field.toString());
             break;
         case 10:
-            builder.wStatus(field);
+            builder.wStatus(field.toString());
             break;
         case 11:
-            builder.wDisplayCount(field);
+            builder.wDisplayCount(field.toString());
             break;
         case 12:
-            builder.wDisplayType(field);
+            builder.wDisplayType(field.toString());
             break;
         case 13:
-            builder.wAltRomName(field);
+            builder.wAltRomName(field.toString());
             break;
         case 14:
-            builder.wAltTitle(field);
+            builder.wAltTitle(field.toString());
             break;
         case 15:
-            builder.wExtra(field);
+            builder.wExtra(field.toString());
             break;
         case 16:
-            builder.wButtons(field);
+            builder.wButtons(field.toString());
             break;
         case 17:
-            builder.wSeries(field);
+            builder.wSeries(field.toString());
             break;
         case 18:
-            builder.wLanguage(field);
+            builder.wLanguage(field.toString());
             break;
         case 19:
-            builder.wRegion(field);
+            builder.wRegion(field.toString());
             break;
         case 20:
-            builder.wRating(field);
+            builder.wRating(field.toString());
             break;
         default:
             qWarning("Unhandled RomEntry field");
@@ -292,6 +372,45 @@ Romlist::Writer::Writer(Romlist* sourceDoc) :
     CommonDocWriter(sourceDoc)
 {}
 
+//-Class Functions----------------------------------------------------------------------------------------------------
+//Private:
+QString Romlist::Writer::entryLine(const RomEntry& romEntry)
+{
+    QString line;
+    appendEntryField(line, romEntry.name().toString(QUuid::WithoutBraces));
+    appendEntryField(line, romEntry.title());
+    appendEntryField(line, romEntry.emulator());
+    appendEntryField(line, romEntry.cloneOf());
+    appendEntryField(line, romEntry.year().toString(Qt::ISODate));
+    appendEntryField(line, romEntry.manufacturer());
+    appendEntryField(line, romEntry.category());
+    appendEntryField(line, romEntry.players());
+    appendEntryField(line, QString::number(romEntry.rotation()));
+    appendEntryField(line, romEntry.control());
+    appendEntryField(line, romEntry.status());
+    appendEntryField(line, QString::number(romEntry.displayCount()));
+    appendEntryField(line, romEntry.displayType());
+    appendEntryField(line, romEntry.altRomName());
+    appendEntryField(line, romEntry.altTitle());
+    appendEntryField(line, romEntry.extra());
+    appendEntryField(line, romEntry.buttons());
+    appendEntryField(line, romEntry.series());
+    appendEntryField(line, romEntry.language());
+    appendEntryField(line, romEntry.region());
+    appendEntryField(line, romEntry.rating(), false);
+
+    return line;
+}
+
+void Romlist::Writer::appendEntryField(QString& line, const QString& entryField, bool writeSeperator)
+{
+    line += '"';
+    line += entryField;
+    line += '"';
+    if(writeSeperator)
+        line += ';';
+}
+
 //-Instance Functions--------------------------------------------------------------------------------------------------
 //Private:
 bool Romlist::Writer::writeSourceDoc()
@@ -309,37 +428,324 @@ bool Romlist::Writer::writeSourceDoc()
 
 bool Romlist::Writer::writeRomEntry(const RomEntry& romEntry)
 {
-    writeEntryField(romEntry.name().toString(QUuid::WithoutBraces));
-    writeEntryField(romEntry.title());
-    writeEntryField(romEntry.emulator());
-    writeEntryField(romEntry.cloneOf());
-    writeEntryField(romEntry.year().toString(Qt::ISODate));
-    writeEntryField(romEntry.manufacturer());
-    writeEntryField(romEntry.category());
-    writeEntryField(romEntry.players());
-    writeEntryField(QString::number(romEntry.rotation()));
-    writeEntryField(romEntry.control());
-    writeEntryField(romEntry.status());
-    writeEntryField(QString::number(romEntry.displayCount()));
-    writeEntryField(romEntry.displayType());
-    writeEntryField(romEntry.altRomName());
-    writeEntryField(romEntry.altTitle());
-    writeEntryField(romEntry.extra());
-    writeEntryField(romEntry.buttons());
-    writeEntryField(romEntry.series());
-    writeEntryField(romEntry.language());
-    writeEntryField(romEntry.region());
-    writeEntryField(romEntry.rating(), false);
-    mStreamWriter << '\n';
-
+    mStreamWriter << entryLine(romEntry) << '\n';
     return !mStreamWriter.hasError();
 }
 
-void Romlist::Writer::writeEntryField(const QString& entryField, bool writeSeperator)
+bool Romlist::Writer::patchList(RomlistIndex& index, Lr::DocHandlingError& error)
 {
-    mStreamWriter << '"' << entryField << '"';
-    if(writeSeperator)
-        mStreamWriter << ';';
+    // Stage every entry that belongs in the list, only the ones that differ from what's on disk are kept
+    source()->mEntries.forEachFinal([&index](const RomEntry& re){
+        index.stage(re.name(), entryLine(re).toUtf8());
+    });
+
+    if(!index.patchWorthwhile())
+        return false;
+
+    QString errStr;
+    if(!index.applyPatch(errStr))
+        error = Lr::DocHandlingError(*source(), Lr::DocHandlingError::DocWriteFailed, errStr);
+
+    return true;
+}
+
+//Public:
+Lr::DocHandlingError Romlist::Writer::writeOutOf()
+{
+    RomlistIndex index(source()->path());
+
+    // The index must be reverted along with the list
+    Import::BackupError bErr = Import::BackupManager::instance()->backupCopy(index.path());
+    if(bErr.type() == Import::BackupError::FileWontDelete)
+        return Lr::DocHandlingError(*source(), Lr::DocHandlingError::CantRemoveBackup);
+    else if(bErr.type() == Import::BackupError::FileWontBackup)
+        return Lr::DocHandlingError(*source(), Lr::DocHandlingError::CantCreateBackup);
+
+    // Patch the list in place if possible
+    Lr::DocHandlingError writeError;
+    if(index.load() && patchList(index, writeError))
+    {
+        if(!writeError.isValid() && !index.save())
+            qWarning("Failed to save romlist index %s", qPrintable(index.path()));
+
+        return writeError;
+    }
+
+    // Otherwise write it out in full and index the result
+    writeError = CommonDocWriter::writeOutOf();
+    if(!writeError.isValid() && (!index.rebuild() || !index.save()))
+        qWarning("Failed to index romlist %s", qPrintable(source()->path()));
+
+    return writeError;
+}
+
+//===============================================================================================================
+// RomlistIndex
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------------
+//Public:
+RomlistIndex::RomlistIndex(const QString& listPath) :
+    mListPath(listPath),
+    mIndexPath(listPath + '.' + EXT),
+    mListSize(-1),
+    mListModified(-1),
+    mCrlf(false),
+    mDeadBytes(0)
+{}
+
+//-Class Functions----------------------------------------------------------------------------------------------------
+//Private:
+quint64 RomlistIndex::lineHash(QByteArrayView line)
+{
+    /* This ends up on disk and a match is taken to mean the line is unchanged, so it must be the same across Qt
+     * versions and architectures (unlike qHash()), and wide enough that a collision isn't a practical concern.
+     */
+    QByteArray digest = QCryptographicHash::hash(line, QCryptographicHash::Sha256);
+    return qFromLittleEndian<quint64>(digest.constData());
+}
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+//Private:
+bool RomlistIndex::listMatches() const
+{
+    QFileInfo listInfo(mListPath);
+    return listInfo.exists() && listInfo.size() == mListSize && listInfo.lastModified().toMSecsSinceEpoch() == mListModified;
+}
+
+void RomlistIndex::recordListState()
+{
+    QFileInfo listInfo(mListPath);
+    mListSize = listInfo.size();
+    mListModified = listInfo.lastModified().toMSecsSinceEpoch();
+}
+
+//Public:
+QString RomlistIndex::path() const { return mIndexPath; }
+
+bool RomlistIndex::load()
+{
+    QFile indexFile(mIndexPath);
+    if(!indexFile.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream in(&indexFile);
+    in.setVersion(QDataStream::Qt_6_0);
+
+    QByteArray magic;
+    quint16 version;
+    in >> magic >> version;
+    if(magic != MAGIC || version != VERSION)
+        return false;
+
+    qint64 count;
+    in >> mListSize >> mListModified >> mCrlf >> mDeadBytes >> count;
+    if(in.status() != QDataStream::Ok || count < 0 || count > indexFile.size())
+        return false;
+
+    mLines.clear();
+    mLines.reserve(count);
+    for(qint64 i = 0; i < count && in.status() == QDataStream::Ok; i++)
+    {
+        QUuid id;
+        Line line;
+        in >> id >> line.offset >> line.length >> line.hash;
+        mLines.insert(id, line);
+    }
+
+    // Only usable if the list hasn't been touched since
+    return in.status() == QDataStream::Ok && listMatches();
+}
+
+bool RomlistIndex::rebuild()
+{
+    mLines.clear();
+    mCrlf = false;
+    mDeadBytes = 0;
+
+    QFile listFile(mListPath);
+    if(!listFile.open(QIODevice::ReadOnly))
+        return false;
+
+    QByteArray data = listFile.readAll();
+    QByteArrayView list(data);
+
+    qsizetype pos = 0;
+    bool header = true;
+    while(pos < list.size())
+    {
+        // Lines must be terminated, or an append would join onto the last one
+        qsizetype eol = list.indexOf('\n', pos);
+        if(eol == -1)
+            return false;
+
+        QByteArrayView line = list.sliced(pos, eol - pos);
+        if(line.endsWith('\r'))
+        {
+            line.chop(1);
+            mCrlf = true;
+        }
+
+        if(line.startsWith('#'))
+        {
+            if(!header)
+                mDeadBytes += line.size();
+        }
+        else if(!line.isEmpty())
+        {
+            // Entries lead with their quoted ID
+            QUuid id = line.size() > 37 && line.front() == '"' ? QUuid::fromString(QLatin1StringView(line.sliced(1, 36))) : QUuid();
+
+            // If it's unclear which line is which the list can't be patched safely
+            if(id.isNull() || mLines.contains(id))
+                return false;
+
+            mLines.insert(id, Line{.offset = pos, .length = qint32(line.size()), .hash = lineHash(line)});
+        }
+
+        header = false;
+        pos = eol + 1;
+    }
+
+    recordListState();
+    return true;
+}
+
+bool RomlistIndex::save()
+{
+    QSaveFile indexFile(mIndexPath);
+    if(!indexFile.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream out(&indexFile);
+    out.setVersion(QDataStream::Qt_6_0);
+
+    out << MAGIC << VERSION << mListSize << mListModified << mCrlf << mDeadBytes << qint64(mLines.size());
+    for(const auto [id, line] : mLines.asKeyValueRange())
+        out << id << line.offset << line.length << line.hash;
+
+    return out.status() == QDataStream::Ok && indexFile.commit();
+}
+
+void RomlistIndex::stage(const QUuid& id, const QByteArray& line)
+{
+    mStaged.insert(id);
+
+    auto itr = mLines.constFind(id);
+    if(itr == mLines.cend() || itr->length != line.size() || itr->hash != lineHash(line))
+        mChanges.append(Change{.id = id, .line = line});
+}
+
+bool RomlistIndex::patchWorthwhile() const
+{
+    // Determine how much of the list would be dead after patching
+    qint64 deadBytes = mDeadBytes;
+    qint64 listSize = mListSize;
+    qint64 terminatorSize = mCrlf ? 2 : 1;
+
+    for(const auto [id, line] : mLines.asKeyValueRange())
+        if(!mStaged.contains(id))
+            deadBytes += line.length;
+
+    for(const Change& change : mChanges)
+    {
+        auto itr = mLines.constFind(change.id);
+        if(itr != mLines.cend())
+        {
+            if(itr->length == change.line.size())
+                continue; // Overwritten in place
+
+            deadBytes += itr->length;
+        }
+
+        listSize += change.line.size() + terminatorSize;
+    }
+
+    return deadBytes * COMPACTION_DIVISOR <= listSize;
+}
+
+bool RomlistIndex::applyPatch(QString& errorString)
+{
+    QFile listFile(mListPath);
+    if(!listFile.open(QIODevice::ReadWrite))
+    {
+        errorString = listFile.errorString();
+        return false;
+    }
+
+    auto writeAt = [&listFile](qint64 offset, QByteArrayView bytes){
+        return listFile.seek(offset) && listFile.write(bytes.data(), bytes.size()) == bytes.size();
+    };
+
+    auto killLine = [&](const Line& line){
+        // Comment the line out without changing its length
+        QByteArray tombstone(line.length, ' ');
+        tombstone[0] = '#';
+        mDeadBytes += line.length;
+        return writeAt(line.offset, tombstone);
+    };
+
+    // Remove entries that no longer belong in the list
+    for(auto itr = mLines.begin(); itr != mLines.end();)
+    {
+        if(mStaged.contains(itr.key()))
+        {
+            itr++;
+            continue;
+        }
+
+        if(!killLine(*itr))
+        {
+            errorString = listFile.errorString();
+            return false;
+        }
+        itr = mLines.erase(itr);
+    }
+
+    // Overwrite changed entries that still fit, append the rest
+    const QByteArray terminator = mCrlf ? "\r\n"_ba : "\n"_ba;
+    const qint64 listEnd = listFile.size();
+    QByteArray appended;
+
+    for(const Change& change : std::as_const(mChanges))
+    {
+        auto itr = mLines.find(change.id);
+        if(itr != mLines.end())
+        {
+            if(itr->length == change.line.size())
+            {
+                if(!writeAt(itr->offset, change.line))
+                {
+                    errorString = listFile.errorString();
+                    return false;
+                }
+                itr->hash = lineHash(change.line);
+                continue;
+            }
+
+            if(!killLine(*itr))
+            {
+                errorString = listFile.errorString();
+                return false;
+            }
+        }
+
+        mLines.insert(change.id, Line{.offset = listEnd + appended.size(), .length = qint32(change.line.size()), .hash = lineHash(change.line)});
+        appended += change.line + terminator;
+    }
+
+    if(!appended.isEmpty() && !writeAt(listEnd, appended))
+    {
+        errorString = listFile.errorString();
+        return false;
+    }
+
+    listFile.close();
+    recordListState();
+
+    mStaged.clear();
+    mChanges.clear();
+    return true;
 }
 
 //===============================================================================================================
@@ -349,29 +755,57 @@ void Romlist::Writer::writeEntryField(const QString& entryField, bool writeSeper
 //-Constructor--------------------------------------------------------------------------------------------------------
 //Public:
 BulkOverviewWriter::BulkOverviewWriter(const QDir& overviewDir) :
-    mOverviewDir(overviewDir),
-    mFile()
+    mOverviewDir(overviewDir)
 {}
 
-//-Instance Functions--------------------------------------------------------------------------------------------------
-//Public:
-QString BulkOverviewWriter::currentFilePath() { return mFile.fileName(); }
-QString BulkOverviewWriter::fileErrorString() { return mFile.errorString(); }
+//-Class Functions----------------------------------------------------------------------------------------------------
+//Private:
+bool BulkOverviewWriter::matchesExisting(const QString& filePath, const QByteArray& content)
+{
+    // Checking the size first avoids reading files that have obviously changed (or don't exist)
+    QFile existing(filePath);
+    if(existing.size() != content.size() || !existing.open(QIODevice::ReadOnly))
+        return false;
 
-bool BulkOverviewWriter::writeOverview(const Overview& overview)
+    return existing.readAll() == content;
+}
+
+QString BulkOverviewWriter::writeOverview(const QString& filePath, const Overview& overview)
 {
-    // Set file to overview path
-    QString fileName = overview.gameId().toString(QUuid::WithoutBraces) + u".txt"_s;
-    mFile.setFileName(mOverviewDir.absoluteFilePath(fileName));
+    QByteArray content = overview.text().toUtf8();
+
+    // Re-imports mostly produce the same text, in which case reading is far cheaper than replacing
+    if(matchesExisting(filePath, content))
+        return {};
 
     // Open file, always truncate
-    mFile.open(QSaveFile::WriteOnly); // Write only implies truncate
+    QSaveFile file(filePath);
+    file.open(QSaveFile::WriteOnly); // Write only implies truncate
 
     // Write overview
-    mFile.write(overview.text().toUtf8());
+    file.write(content);
 
     // Save and return status
-    return mFile.commit();
+    return file.commit() ? QString() : file.errorString() + u" ("_s + filePath + ')';
+}
+
+//-Instance Functions--------------------------------------------------------------------------------------------------
+//Public:
+QString BulkOverviewWriter::errorString() { return mErrorString; }
+
+bool BulkOverviewWriter::writeOverviews(const QList<Overview>& overviews)
+{
+    // Each overview is its own file, so they can be handled in parallel
+    auto write = [this](const Overview& overview){
+        QString fileName = overview.gameId().toString(QUuid::WithoutBraces) + u".txt"_s;
+        return writeOverview(mOverviewDir.absoluteFilePath(fileName), overview);
+    };
+    const QStringList errors = QtConcurrent::blockingMapped<QStringList>(overviews, write);
+
+    // Report the first failure
+    auto failure = std::find_if(errors.cbegin(), errors.cend(), [](const QString& e){ return !e.isEmpty(); });
+    mErrorString = failure != errors.cend() ? *failure : QString();
+    return mErrorString.isEmpty();
 }
 
 //===============================================================================================================
@@ -395,7 +829,7 @@ const RomEntry* PlatformInterface::processSet(const Fp::Set& set)
     const Fp::Game& game = set.game();
 
     // Add game ID to platform tag list
-    mPlatformTaglist.appendTag(game.id().toString(QUuid::WithoutBraces));
+    mPlatformTaglist.appendTag(game.id());
 
     // Create game overview
     QString overviewText = game.originalDescription();
@@ -406,7 +840,7 @@ const RomEntry* PlatformInterface::processSet(const Fp::Set& set)
 
     // Add add app IDs to platform tag list
     for(const Fp::AddApp& addApp : set.addApps())
-        mPlatformTaglist.appendTag(addApp.id().toString(QUuid::WithoutBraces));
+        mPlatformTaglist.appendTag(addApp.id());
 
     //-Forward game insertion to main Romlist--------------------------------
     return install()->mRomlist->processSet(set);
@@ -453,13 +887,9 @@ Lr::DocHandlingError PlatformInterfaceWriter::writeOutOf()
     if(auto err = mTaglistWriter.writeOutOf())
         return err;
 
-    // Write overviews
-    for(const auto& o : std::as_const(source()->mOverviews))
-    {
-        // This uses QSaveFile as a form of "safe replace" write, so we don't need to manually back-up
-        if(!mOverviewWriter.writeOverview(o))
-            return Lr::DocHandlingError(*source(), Lr::DocHandlingError::DocWriteFailed, mOverviewWriter.fileErrorString());
-    }
+    // Write overviews. This uses QSaveFile as a form of "safe replace" write, so we don't need to manually back-up
+    if(!mOverviewWriter.writeOverviews(source()->mOverviews))
+        return Lr::DocHandlingError(*source(), Lr::DocHandlingError::DocWriteFailed, mOverviewWriter.errorString());
 
     return {};
 }
@@ -481,13 +911,13 @@ bool PlaylistInterface::isEmpty() const { return mPlaylistTaglist.isEmpty(); }
 
 bool PlaylistInterface::containsPlaylistGame(const QUuid& gameId) const
 {
-    return mPlaylistTaglist.containsTag(gameId.toString(QUuid::WithoutBraces));
+    return mPlaylistTaglist.containsTag(gameId);
 }
 
 void PlaylistInterface::setPlaylistData(const Fp::Playlist& playlist)
 {
     for(const auto& pl : playlist.playlistGames())
-        mPlaylistTaglist.appendTag(pl.gameId().toString(QUuid::WithoutBraces));
+        mPlaylistTaglist.appendTag(pl.gameId());
 }
 
 //===============================================================================================================
@@ -614,7 +1044,7 @@ void EmulatorReader::parseArtwork(const QString& value)
     eaeb.wType(type);
     eaeb.wPaths(!rawPaths.isEmpty() ? rawPaths.split(';') : QStringList());
 
-    target()->setArtworkEntry(eaeb.build());
+    target()->setArtworkEntry(std::move(eaeb).build());
 }
 
 //===============================================================================================================
@@ -1,6 +1,11 @@
 #ifndef ATTRACTMODE_DATA_H
 #define ATTRACTMODE_DATA_H
 
+// Qt Includes
+#include <QSet>
+#include <QHash>
+#include <QUuid>
+
 // Qx Includes
 #include <qx/io/qx-textstreamreader.h>
 #include <qx/io/qx-textstreamwriter.h>
@@ -134,7 +139,9 @@ public:
 
 //-Instance Variables--------------------------------------------------------------------------------------------------
 protected:
-    QStringList mTags;
+    // Tags are always IDs here, so they're kept as such and only turned into text when written
+    QList<QUuid> mTags;
+    QSet<QUuid> mTagSet;
 
 //-Constructor--------------------------------------------------------------------------------------------------------
 protected:
@@ -144,8 +151,8 @@ protected:
 public:
     bool isEmpty() const override;
 
-    bool containsTag(QStringView tag) const;
-    void appendTag(const QString& tag);
+    bool containsTag(const QUuid& tag) const;
+    void appendTag(const QUuid& tag);
 };
 
 class Taglist::Writer : public CommonDocWriter<Taglist>
@@ -183,6 +190,8 @@ public:
     Type type() const override;
 };
 
+class RomlistIndex;
+
 class Romlist : public Lr::UpdatableDoc<LauncherId>
 {
     /* This class looks like it should inherit PlatformDoc, but it isn't truly one in the context of an Am install
@@ -231,7 +240,7 @@ private:
     bool checkDocValidity(bool& isValid) override;
     Lr::DocHandlingError readTargetDoc() override;
     void parseRomEntry(const QString& rawEntry);
-    void addFieldToBuilder(RomEntry::Builder& builder, QString field, quint8 index);
+    void addFieldToBuilder(RomEntry::Builder& builder, QStringView field, quint8 index);
 };
 
 class Romlist::Writer : public CommonDocWriter<Romlist>
@@ -240,11 +249,94 @@ class Romlist::Writer : public CommonDocWriter<Romlist>
 public:
     Writer(Romlist* sourceDoc);
 
+//-Class Functions----------------------------------------------------------------------------------------------------
+private:
+    static QString entryLine(const RomEntry& romEntry);
+    static void appendEntryField(QString& line, const QString& entryField, bool writeSeperator = true);
+
 //-Instance Functions-------------------------------------------------------------------------------------------------
 private:
     bool writeSourceDoc() override;
     bool writeRomEntry(const RomEntry& romEntry);
-    void writeEntryField(const QString& entryField, bool writeSeperator = true);
+    bool patchList(RomlistIndex& index, Lr::DocHandlingError& error);
+
+public:
+    Lr::DocHandlingError writeOutOf() override;
+};
+
+/* Sidecar index for the romlist that records where each entry's line is in the file, along with a hash of the line,
+ * so that an import that only touches a few entries can patch them in place instead of rewriting the entire list.
+ *
+ * Lines that are no longer needed, or that need to grow/shrink, are turned into comments (which both AttractMode and
+ * FIL skip) and replacements are appended to the end. Once enough of the file is dead the list is just rewritten.
+ * The index is only trusted if the list's size and modification time match what was recorded, so any outside change
+ * to the list causes a full rewrite.
+ */
+class RomlistIndex
+{
+//-Structs------------------------------------------------------------------------------------------------------------
+private:
+    struct Line
+    {
+        qint64 offset;
+        qint32 length; // Without line terminator
+        quint64 hash;
+    };
+
+    struct Change
+    {
+        QUuid id;
+        QByteArray line;
+    };
+
+//-Class Variables----------------------------------------------------------------------------------------------------
+public:
+    static inline const QString EXT = u"index"_s;
+
+private:
+    static inline const QByteArray MAGIC = "FILROMIDX"_ba;
+    static inline const quint16 VERSION = 2;
+
+    // Compact once dead lines would make up more than 1/N of the list
+    static inline const qint64 COMPACTION_DIVISOR = 4;
+
+//-Instance Variables-------------------------------------------------------------------------------------------------
+private:
+    QString mListPath;
+    QString mIndexPath;
+    qint64 mListSize;
+    qint64 mListModified;
+    bool mCrlf;
+    qint64 mDeadBytes;
+    QHash<QUuid, Line> mLines;
+
+    // Staged patch
+    QSet<QUuid> mStaged;
+    QList<Change> mChanges;
+
+//-Constructor--------------------------------------------------------------------------------------------------------
+public:
+    explicit RomlistIndex(const QString& listPath);
+
+//-Class Functions----------------------------------------------------------------------------------------------------
+private:
+    static quint64 lineHash(QByteArrayView line);
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+private:
+    bool listMatches() const;
+    void recordListState();
+
+public:
+    QString path() const;
+
+    bool load();
+    bool rebuild();
+    bool save();
+
+    void stage(const QUuid& id, const QByteArray& line);
+    bool patchWorthwhile() const;
+    bool applyPatch(QString& errorString);
 };
 
 class BulkOverviewWriter
@@ -252,17 +344,21 @@ class BulkOverviewWriter
 //-Instance Variables--------------------------------------------------------------------------------------------------
 private:
     QDir mOverviewDir;
-    QSaveFile mFile;
+    QString mErrorString;
 
 //-Constructor--------------------------------------------------------------------------------------------------------
 public:
     BulkOverviewWriter(const QDir& overviewDir);
 
+//-Class Functions----------------------------------------------------------------------------------------------------
+private:
+    static bool matchesExisting(const QString& filePath, const QByteArray& content);
+    static QString writeOverview(const QString& filePath, const Overview& overview);
+
 //-Instance Functions--------------------------------------------------------------------------------------------------
 public:
-    QString currentFilePath();
-    QString fileErrorString();
-    bool writeOverview(const Overview& overview);
+    QString errorString();
+    bool writeOverviews(const QList<Overview>& overviews);
 };
 
 class PlatformInterface : public Lr::PlatformDoc<LauncherId>
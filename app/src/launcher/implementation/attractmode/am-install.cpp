@@ -105,6 +105,12 @@ Qx::Error Install::populateExistingDocs(QSet<Lr::IDataDoc::Identifier>& existing
     return Qx::Error();
 }
 
+QStringList Install::existingDocWatchPaths() const
+{
+    // The tag directory and romlist are within the romlists directory
+    return {mRomlistsDirectory.absolutePath(), mEmulatorsDirectory.absolutePath(), mMainConfigFile.fileName()};
+}
+
 std::unique_ptr<PlatformInterface> Install::preparePlatformDocCheckout(const QString& translatedName)
 {
     // Determine path to the taglist that corresponds with the interface
@@ -249,6 +255,8 @@ bool Install::isRunning() const
     return Qx::processIsRunning(mMainExe.fileName()) || Qx::processIsRunning(mConsoleExe.fileName());
 }
 
+bool Install::usesGameTags() const { return false; }
+
 QString Install::versionString() const
 {
     // Limits to first 3 segments for consistency since that's what AttractMode seems to use
@@ -308,7 +316,7 @@ Qx::Error Install::preImport()
             return Qx::IoOpReport(Qx::IO_OP_WRITE, Qx::IO_ERR_CANT_CREATE, overviewDir);
 
     // Logo and screenshot dir
-    auto details = Import::Details::current();
+    const auto& details = Import::Details::current();
     if(details.imageMode == Import::ImageMode::Copy || details.imageMode == Import::ImageMode::Link)
     {
         QDir logoDir(mFpScraperDirectory.absoluteFilePath(LOGO_FOLDER_NAME));
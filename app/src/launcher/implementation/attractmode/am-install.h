@@ -85,6 +85,7 @@ public:
 private:
     // Install management
     Qx::Error populateExistingDocs(QSet<Lr::IDataDoc::Identifier>& existingDocs) override;
+    QStringList existingDocWatchPaths() const override;
     QString versionFromExecutable() const;
 
     // Doc handling
@@ -105,6 +106,7 @@ public:
     // Info
     QList<Import::ImageMode> preferredImageModeOrder() const override;
     bool isRunning() const override;
+    bool usesGameTags() const override;
     QString versionString() const override;
     QString translateDocName(const QString& originalName, Lr::IDataDoc::Type type) const override;
 
@@ -140,44 +140,32 @@ Lr::DocHandlingError GamelistReader::readTargetDoc()
 
 void GamelistReader::parseGame()
 {
+    static const Lr::ElementDispatch<Game::Builder> dispatch{
+        {Xml::Game::PATH, [](auto& b, auto& r){
+            QString path = r.readElementText();
+            b.wPath(path);
+            b.wId(Game::idFromFilename(QFileInfo(path).fileName()));
+        }},
+        {Xml::Game::NAME, [](auto& b, auto& r){ b.wName(r.readElementText()); }},
+        {Xml::Game::SORT_NAME, [](auto& b, auto& r){ b.wSortName(r.readElementText()); }},
+        {Xml::Game::COLLECTION_SORT_NAME, [](auto& b, auto& r){ b.wCollectionSortName(r.readElementText()); }},
+        {Xml::Game::DESC, [](auto& b, auto& r){ b.wDesc(r.readElementText()); }},
+        {Xml::Game::RELEASE_DATE, [](auto& b, auto& r){ b.wReleaseDate(r.readElementText()); }},
+        {Xml::Game::DEVELOPER, [](auto& b, auto& r){ b.wDeveloper(r.readElementText()); }},
+        {Xml::Game::PUBLISHER, [](auto& b, auto& r){ b.wPublisher(r.readElementText()); }},
+        {Xml::Game::GENRE, [](auto& b, auto& r){ b.wGenre(r.readElementText()); }},
+        {Xml::Game::PLAYERS, [](auto& b, auto& r){ b.wPlayers(r.readElementText()); }},
+        {Xml::Game::KID_GAME, [](auto& b, auto& r){ b.wKidGame(r.readElementText()); }}
+    };
+
     // Game to build
     Game::Builder gb;
 
     // Cover all children
-    while(mStreamReader.readNextStartElement())
-    {
-        if(mStreamReader.name() == Xml::Game::PATH)
-        {
-            QString path = mStreamReader.readElementText();
-            gb.wPath(path);
-            gb.wId(Game::idFromFilename(QFileInfo(path).fileName()));
-        }
-        else if(mStreamReader.name() == Xml::Game::NAME)
-            gb.wName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Game::SORT_NAME)
-            gb.wSortName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Game::COLLECTION_SORT_NAME)
-            gb.wCollectionSortName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Game::DESC)
-            gb.wDesc(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Game::RELEASE_DATE)
-            gb.wReleaseDate(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Game::DEVELOPER)
-            gb.wDeveloper(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Game::PUBLISHER)
-            gb.wPublisher(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Game::GENRE)
-            gb.wGenre(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Game::PLAYERS)
-            gb.wPlayers(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Game::KID_GAME)
-            gb.wKidGame(mStreamReader.readElementText());
-        else
-            gb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
-    }
+    readChildElements(gb, dispatch);
 
     // Build Game and add to document
-    target()->mGames.insert(gb.build());
+    target()->mGames.insert(std::move(gb).build());
 }
 
 void GamelistReader::parseFolder()
@@ -195,7 +183,7 @@ void GamelistReader::parseFolder()
     }
 
     // Build folder and add to document
-    target()->mFolders.append(fb.build());
+    target()->mFolders.append(std::move(fb).build());
 }
 
 //===============================================================================================================
@@ -288,12 +276,34 @@ bool GamelistWriter::updateDummyFiles()
     if(!systemRomDir.mkpath(u"."_s))
         return false;
 
+    // Get present files in one go so that each dummy doesn't need to be checked individually
+    const QStringList presentNames = systemRomDir.entryList(QDir::Files | QDir::Hidden | QDir::System);
+    QSet<QString> presentFiles;
+    presentFiles.reserve(presentNames.size());
+    for(const QString& name : presentNames)
+        presentFiles.insert(systemRomDir.absoluteFilePath(name));
+
+    auto dummyPath = [&](const Game& game){ return QDir::cleanPath(systemRomDir.absoluteFilePath(game.path())); };
+
+    // Determine obsolete dummy files that need to be removed, and new ones that need to be created
+    QStringList obsoletePaths;
+    source()->mGames.forEachObsolete([&](const Game& obsGame){
+        if(QString p = dummyPath(obsGame); presentFiles.contains(p))
+            obsoletePaths.append(p);
+    });
+
+    QStringList newPaths;
+    source()->mGames.forEachNew([&](const Game& newGame){
+        if(QString p = dummyPath(newGame); !presentFiles.contains(p))
+            newPaths.append(p);
+    });
+
     // Remove obsolete dummy files
-    if(!source()->mGames.forEachObsolete([&](const Game& obsGame){ return !bm->revertableRemove(systemRomDir.absoluteFilePath(obsGame.path())).isValid(); }))
+    if(!obsoletePaths.isEmpty() && bm->revertableRemove(obsoletePaths).isValid())
         return false;
 
     // Add new dummy files
-    if(!source()->mGames.forEachNew([&](const Game& newGame){ return !bm->revertableTouch(systemRomDir.absoluteFilePath(newGame.path())).isValid(); }))
+    if(!newPaths.isEmpty() && bm->revertableTouch(newPaths).isValid())
         return false;
 
     return true;
@@ -450,35 +460,31 @@ Lr::DocHandlingError SystemlistReader::readTargetDoc()
 
 void SystemlistReader::parseSystem()
 {
-    // Game to build
+    static const Lr::ElementDispatch<System::Builder> dispatch{
+        {Xml::System::NAME, [](auto& b, auto& r){ b.wName(r.readElementText()); }},
+        {Xml::System::FULL_NAME, [](auto& b, auto& r){ b.wFullName(r.readElementText()); }},
+        {Xml::System::SYSTEM_SORT_NAME, [](auto& b, auto& r){ b.wSystemSortName(r.readElementText()); }},
+        {Xml::System::PATH, [](auto& b, auto& r){ b.wPath(r.readElementText()); }},
+        {Xml::System::EXTENSION, [](auto& b, auto& r){ b.wExtension(r.readElementText()); }},
+        {Xml::System::COMMAND, [](auto& b, auto& r){
+            // Attributes must be read before the text, which advances the reader
+            QString label = r.attributes().value(Xml::System::COMMAND_ATTR_LABEL).toString();
+            b.wCommand(label, r.readElementText());
+        }},
+        {Xml::System::PLATFORM, [](auto& b, auto& r){ b.wPlatform(r.readElementText()); }},
+        {Xml::System::THEME, [](auto& b, auto& r){ b.wTheme(r.readElementText()); }}
+    };
+
+    // System to build
     System::Builder sb;
 
     // Cover all children
-    while(mStreamReader.readNextStartElement())
-    {
-        if(mStreamReader.name() == Xml::System::NAME)
-            sb.wName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::System::FULL_NAME)
-            sb.wFullName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::System::SYSTEM_SORT_NAME)
-            sb.wSystemSortName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::System::PATH)
-            sb.wPath(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::System::EXTENSION)
-            sb.wExtension(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::System::COMMAND)
-            sb.wCommand(mStreamReader.attributes().value(Xml::System::COMMAND_ATTR_LABEL).toString(), mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::System::PLATFORM)
-            sb.wPlatform(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::System::THEME)
-            sb.wTheme(mStreamReader.readElementText());
-        else
-            sb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
-    }
+    readChildElements(sb, dispatch);
 
     // Build System and add to document
-    System existingSystem = sb.build();
-    target()->mSystems[existingSystem.fullName()] = existingSystem;
+    System existingSystem = std::move(sb).build();
+    QString fullName = existingSystem.fullName();
+    target()->mSystems[fullName] = std::move(existingSystem);
 }
 
 //===============================================================================================================
@@ -102,6 +102,16 @@ Qx::Error Install::populateExistingDocs(QSet<Lr::IDataDoc::Identifier>& existing
     return Qx::Error();
 }
 
+QStringList Install::existingDocWatchPaths() const
+{
+    // Platforms come from the content of the custom systems file, so it's watched directly when present
+    QStringList paths{mCollectionsDir.absolutePath(), mCustomSystemsDir.absolutePath()};
+    if(mCustomSystemsFile.exists())
+        paths.append(mCustomSystemsFile.fileName());
+
+    return paths;
+}
+
 QString Install::dataDocPath(Lr::IDataDoc::Identifier identifier) const
 {
     switch(identifier.docType())
@@ -98,6 +98,7 @@ private:
 private:
     // Install management
     Qx::Error populateExistingDocs(QSet<Lr::IDataDoc::Identifier>& existingDocs) override;
+    QStringList existingDocWatchPaths() const override;
     QString versionFromExecutable() const;
 
     // Doc handling
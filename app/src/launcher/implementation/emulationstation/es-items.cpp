@@ -23,10 +23,10 @@ Game::Game(const Fp::Game& fpGame, const Fp::GameTags& fpTags, const QString& sy
     mCollectionSortName(mSortName),
     mDesc(fpGame.notes()),
     mReleaseDate(fpGame.releaseDate()),
-    mDeveloper(fpGame.developer()),
-    mPublisher(fpGame.publisher()),
+    mDeveloper(Import::StringPool::intern(fpGame.developer())),
+    mPublisher(Import::StringPool::intern(fpGame.publisher())),
     mGenre(fpTags.tags(u"genre"_s).join(u" | "_s)),
-    mPlayers(fpGame.playMode()),
+    mPlayers(Import::StringPool::intern(fpGame.playMode())),
     mKidGame(fpTags.tags(u"warning"_s).isEmpty())
 {}
 
@@ -39,10 +39,10 @@ Game::Game(const Fp::AddApp& fpAddApp, const Fp::Game& parentGame, const Fp::Gam
     mCollectionSortName(mSortName),
     mDesc(),
     mReleaseDate(parentGame.releaseDate()),
-    mDeveloper(parentGame.developer()),
-    mPublisher(parentGame.publisher()),
+    mDeveloper(Import::StringPool::intern(parentGame.developer())),
+    mPublisher(Import::StringPool::intern(parentGame.publisher())),
     mGenre(parentGameTags.tags(u"genre"_s).join(u" | "_s)),
-    mPlayers(parentGame.playMode()),
+    mPlayers(Import::StringPool::intern(parentGame.playMode())),
     mKidGame(parentGameTags.tags(u"warning"_s).isEmpty())
 {}
 
@@ -1,8 +1,13 @@
 // Unit Include
 #include "lb-data.h"
 
+// Standard Library Includes
+#include <algorithm>
+#include <variant>
+
 // Project Includes
 #include "import/details.h"
+#include "import/backup.h"
 #include "launcher/implementation/launchbox/lb-install.h"
 
 namespace Xml
@@ -129,6 +134,62 @@ PlatformDoc::PlatformDoc(Install* install, const QString& xmlPath, const QString
     mCustomFields(this)
 {}
 
+//-Class Functions----------------------------------------------------------------------------------------------------
+//Private:
+const Lr::ElementDispatch<Game::Builder>& PlatformDoc::gameElements()
+{
+    static const Lr::ElementDispatch<Game::Builder> dispatch{
+        {Xml::Element_Game::ELEMENT_ID, [](auto& b, auto& r){ b.wId(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_TITLE, [](auto& b, auto& r){ b.wTitle(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_SERIES, [](auto& b, auto& r){ b.wSeries(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_DEVELOPER, [](auto& b, auto& r){ b.wDeveloper(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_PUBLISHER, [](auto& b, auto& r){ b.wPublisher(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_PLATFORM, [](auto& b, auto& r){ b.wPlatform(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_SORT_TITLE, [](auto& b, auto& r){ b.wSortTitle(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_DATE_ADDED, [](auto& b, auto& r){ b.wDateAdded(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_DATE_MODIFIED, [](auto& b, auto& r){ b.wDateModified(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_BROKEN, [](auto& b, auto& r){ b.wBroken(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_PLAYMODE, [](auto& b, auto& r){ b.wPlayMode(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_STATUS, [](auto& b, auto& r){ b.wStatus(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_REGION, [](auto& b, auto& r){ b.wRegion(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_NOTES, [](auto& b, auto& r){ b.wNotes(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_SOURCE, [](auto& b, auto& r){ b.wSource(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_APP_PATH, [](auto& b, auto& r){ b.wAppPath(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_COMMAND_LINE, [](auto& b, auto& r){ b.wCommandLine(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_RELEASE_DATE, [](auto& b, auto& r){ b.wReleaseDate(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_VERSION, [](auto& b, auto& r){ b.wVersion(r.readElementText()); }},
+        {Xml::Element_Game::ELEMENT_RELEASE_TYPE, [](auto& b, auto& r){ b.wReleaseType(r.readElementText()); }}
+    };
+
+    return dispatch;
+}
+
+const Lr::ElementDispatch<AddApp::Builder>& PlatformDoc::addAppElements()
+{
+    static const Lr::ElementDispatch<AddApp::Builder> dispatch{
+        {Xml::Element_AddApp::ELEMENT_ID, [](auto& b, auto& r){ b.wId(r.readElementText()); }},
+        {Xml::Element_AddApp::ELEMENT_GAME_ID, [](auto& b, auto& r){ b.wGameId(r.readElementText()); }},
+        {Xml::Element_AddApp::ELEMENT_APP_PATH, [](auto& b, auto& r){ b.wAppPath(r.readElementText()); }},
+        {Xml::Element_AddApp::ELEMENT_COMMAND_LINE, [](auto& b, auto& r){ b.wCommandLine(r.readElementText()); }},
+        {Xml::Element_AddApp::ELEMENT_AUTORUN_BEFORE, [](auto& b, auto& r){ b.wAutorunBefore(r.readElementText()); }},
+        {Xml::Element_AddApp::ELEMENT_NAME, [](auto& b, auto& r){ b.wName(r.readElementText()); }},
+        {Xml::Element_AddApp::ELEMENT_WAIT_FOR_EXIT, [](auto& b, auto& r){ b.wWaitForExit(r.readElementText()); }}
+    };
+
+    return dispatch;
+}
+
+const Lr::ElementDispatch<CustomField::Builder>& PlatformDoc::customFieldElements()
+{
+    static const Lr::ElementDispatch<CustomField::Builder> dispatch{
+        {Xml::Element_CustomField::ELEMENT_GAME_ID, [](auto& b, auto& r){ b.wGameId(r.readElementText()); }},
+        {Xml::Element_CustomField::ELEMENT_NAME, [](auto& b, auto& r){ b.wName(r.readElementText()); }},
+        {Xml::Element_CustomField::ELEMENT_VALUE, [](auto& b, auto& r){ b.wValue(r.readElementText()); }}
+    };
+
+    return dispatch;
+}
+
 //-Instance Functions--------------------------------------------------------------------------------------------------
 //Private:
 Game PlatformDoc::prepareGame(const Fp::Game& game)
@@ -145,7 +206,7 @@ Game PlatformDoc::prepareGame(const Fp::Game& game)
     cfb.wGameId(game.id());
     cfb.wName(CustomField::LANGUAGE);
     cfb.wValue(game.language());
-    addCustomField(cfb.build());
+    addCustomField(std::move(cfb).build());
 
     // Return converted game
     return lbGame;
@@ -161,7 +222,7 @@ AddApp PlatformDoc::prepareAddApp(const Fp::AddApp& addApp)
     return lbAddApp;
 }
 
-void PlatformDoc::addCustomField(CustomField&& customField) { mCustomFields.insert(customField); }
+void PlatformDoc::addCustomField(CustomField&& customField) { mCustomFields.insert(std::move(customField)); }
 
 //Public:
 bool PlatformDoc::isEmpty() const
@@ -185,12 +246,68 @@ void PlatformDoc::preCommit()
 //Public:
 PlatformDocReader::PlatformDocReader(PlatformDoc* targetDoc) :
     Lr::XmlDocReader<PlatformDoc>(targetDoc, Xml::ROOT_ELEMENT)
-{}
+{
+    // The doc shares the parsed bytes for splicing unchanged entries back out
+    setRetainRawData(true);
+}
 
 //-Instance Functions-------------------------------------------------------------------------------------------------
 //Private:
+bool PlatformDocReader::readSnapshot()
+{
+    Lr::DocSnapshot snapshot(target()->path());
+    QByteArray sourceXml;
+    if(!snapshot.load(PlatformDoc::SNAPSHOT_VERSION, sourceXml))
+        return false;
+
+    // Read everything before adding any of it so that a bad snapshot leaves the doc untouched
+    QDataStream& in = snapshot.stream();
+    QList<Game> games;
+    QList<AddApp> addApps;
+    QList<CustomField> customFields;
+
+    auto readItems = [&]<typename T>(QList<T>& items){
+        qint64 count;
+        in >> count;
+        if(in.status() != QDataStream::Ok || count < 0 || count > sourceXml.size())
+            return false;
+
+        items.reserve(count);
+        for(qint64 i = 0; i < count && in.status() == QDataStream::Ok; i++)
+        {
+            qint64 offset, length;
+            in >> offset >> length;
+            if(offset < 0 || length <= 0 || offset > sourceXml.size() - length)
+                return false;
+
+            // Markup views this data, which is handed over to the doc as is below
+            items.emplaceBack().readSnapshot(in, QByteArrayView(sourceXml).sliced(offset, length));
+        }
+
+        return in.status() == QDataStream::Ok;
+    };
+
+    if(!readItems(games) || !readItems(addApps) || !readItems(customFields))
+        return false;
+
+    target()->mSourceXml = std::move(sourceXml);
+    for(Game& g : games)
+        target()->mGames.insert(std::move(g));
+    for(AddApp& aa : addApps)
+        target()->mAddApps.insert(std::move(aa));
+    for(CustomField& cf : customFields)
+        target()->mCustomFields.insert(std::move(cf));
+
+    return true;
+}
+
 Lr::DocHandlingError PlatformDocReader::readTargetDoc()
 {
+    /* Keep the document's markup so that entries only need their known fields parsed, and can be written back out
+     * as-is if they end up unchanged, which is most of them for large platforms that are updated often.
+     */
+    target()->mSourceXml = rawData();
+
     while(mStreamReader.readNextStartElement())
     {
         if(mStreamReader.name() == Xml::Element_Game::NAME)
@@ -213,54 +330,10 @@ void PlatformDocReader::parseGame()
     Game::Builder gb;
 
     // Cover all children
-    while(mStreamReader.readNextStartElement())
-    {
-        if(mStreamReader.name() == Xml::Element_Game::ELEMENT_ID)
-            gb.wId(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_TITLE)
-            gb.wTitle(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_SERIES)
-            gb.wSeries(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_DEVELOPER)
-            gb.wDeveloper(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_PUBLISHER)
-            gb.wPublisher(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_PLATFORM)
-            gb.wPlatform(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_SORT_TITLE)
-            gb.wSortTitle(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_DATE_ADDED)
-            gb.wDateAdded(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_DATE_MODIFIED)
-            gb.wDateModified(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_BROKEN)
-            gb.wBroken(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_PLAYMODE)
-            gb.wPlayMode(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_STATUS)
-            gb.wStatus(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_REGION)
-            gb.wRegion(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_NOTES)
-            gb.wNotes(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_SOURCE)
-            gb.wSource(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_APP_PATH)
-            gb.wAppPath(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_COMMAND_LINE)
-            gb.wCommandLine(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_RELEASE_DATE)
-            gb.wReleaseDate(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_VERSION)
-            gb.wVersion(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_Game::ELEMENT_RELEASE_TYPE)
-            gb.wReleaseType(mStreamReader.readElementText());
-        else
-            gb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
-    }
+    readChildElements(gb, PlatformDoc::gameElements(), target()->mSourceXml);
 
     // Build Game and add to document
-    target()->mGames.insert(gb.build());
+    target()->mGames.insert(std::move(gb).build());
 }
 
 void PlatformDocReader::parseAddApp()
@@ -269,28 +342,10 @@ void PlatformDocReader::parseAddApp()
     AddApp::Builder aab;
 
     // Cover all children
-    while(mStreamReader.readNextStartElement())
-    {
-        if(mStreamReader.name() == Xml::Element_AddApp::ELEMENT_ID)
-            aab.wId(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_AddApp::ELEMENT_GAME_ID)
-            aab.wGameId(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_AddApp::ELEMENT_APP_PATH)
-            aab.wAppPath(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_AddApp::ELEMENT_COMMAND_LINE)
-            aab.wCommandLine(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_AddApp::ELEMENT_AUTORUN_BEFORE)
-            aab.wAutorunBefore(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_AddApp::ELEMENT_NAME)
-            aab.wName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_AddApp::ELEMENT_WAIT_FOR_EXIT)
-            aab.wWaitForExit(mStreamReader.readElementText());
-        else
-            aab.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
-    }
+    readChildElements(aab, PlatformDoc::addAppElements(), target()->mSourceXml);
 
     // Build Additional App and add to document
-    target()->mAddApps.insert(aab.build());
+    target()->mAddApps.insert(std::move(aab).build());
 }
 
 void PlatformDocReader::parseCustomField()
@@ -299,20 +354,20 @@ void PlatformDocReader::parseCustomField()
     CustomField::Builder cfb;
 
     // Cover all children
-    while(mStreamReader.readNextStartElement())
-    {
-        if(mStreamReader.name() == Xml::Element_CustomField::ELEMENT_GAME_ID)
-            cfb.wGameId(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_CustomField::ELEMENT_NAME)
-            cfb.wName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_CustomField::ELEMENT_VALUE)
-            cfb.wValue(mStreamReader.readElementText());
-        else
-            cfb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
-    }
+    readChildElements(cfb, PlatformDoc::customFieldElements(), target()->mSourceXml);
 
     // Build Custom Field and add to document
-    target()->mCustomFields.insert(cfb.build());
+    target()->mCustomFields.insert(std::move(cfb).build());
+}
+
+//Public:
+Lr::DocHandlingError PlatformDocReader::readInto()
+{
+    // Skip parsing entirely if the doc is still exactly as it was when last written
+    if(readSnapshot())
+        return {};
+
+    return Lr::XmlDocReader<PlatformDoc>::readInto();
 }
 
 //===============================================================================================================
@@ -323,23 +378,51 @@ void PlatformDocReader::parseCustomField()
 //Public:
 PlatformDocWriter::PlatformDocWriter(PlatformDoc* sourceDoc) :
     Lr::XmlDocWriter<PlatformDoc>(sourceDoc, Xml::ROOT_ELEMENT)
-{}
+{
+    setSpanTracking(true);
+}
 
 //-Instance Functions-------------------------------------------------------------------------------------------------
 //Private:
 bool PlatformDocWriter::writeSourceDoc()
 {
-    // Write all games
-    if(!source()->mGames.forEachFinal([this](const Game& g){ return writeGame(g); }))
-        return false;
-
-    // Write all additional apps
-    if(!source()->mAddApps.forEachFinal([this](const AddApp& aa){ return writeAddApp(aa); }))
-        return false;
+    /* Entries read from the original document are written in the order they appeared in it, whether they're copied
+     * out verbatim or re-written, so that an import only changes the parts of the file it actually touches. All
+     * original markup views the doc's source, so its address gives that order. New entries follow, by type.
+     */
+    using Entry = std::variant<const Game*, const AddApp*, const CustomField*>;
+    QList<Entry> entries;
+    source()->mGames.forEachFinal([&entries](const Game& g){ entries.append(&g); });
+    source()->mAddApps.forEachFinal([&entries](const AddApp& aa){ entries.append(&aa); });
+    source()->mCustomFields.forEachFinal([&entries](const CustomField& cf){ entries.append(&cf); });
+
+    auto sourcePos = [](const Entry& e){
+        return std::visit([](const Lr::Item* item){ return item->originalMarkup().data(); }, e);
+    };
+    std::stable_sort(entries.begin(), entries.end(), [&sourcePos](const Entry& a, const Entry& b){
+        const char* aPos = sourcePos(a);
+        const char* bPos = sourcePos(b);
+        return aPos && (!bPos || aPos < bPos);
+    });
 
-    // Write all custom fields
-    if(!source()->mCustomFields.forEachFinal([this](const CustomField& cf){ return writeCustomField(cf); }))
-        return false;
+    // Write all entries
+    for(const Entry& e : entries)
+    {
+        bool written = std::visit([this](const auto* item){
+            using ItemT = std::remove_cvref_t<decltype(*item)>;
+            if(writeOriginal(*item))
+                return true;
+            else if constexpr(std::is_same_v<ItemT, Game>)
+                return writeGame(*item);
+            else if constexpr(std::is_same_v<ItemT, AddApp>)
+                return writeAddApp(*item);
+            else
+                return writeCustomField(*item);
+        }, e);
+
+        if(!written)
+            return false;
+    }
 
     // Return true on success
     return true;
@@ -349,6 +432,7 @@ bool PlatformDocWriter::writeGame(const Game& game)
 {
     // Write opening tag
     mStreamWriter.writeStartElement(Xml::Element_Game::NAME);
+    beginItem(Xml::Element_Game::NAME);
 
     // Write known tags
     writeCleanTextElement(Xml::Element_Game::ELEMENT_ID, game.id().toString(QUuid::WithoutBraces));
@@ -381,10 +465,11 @@ bool PlatformDocWriter::writeGame(const Game& game)
     writeCleanTextElement(Xml::Element_Game::ELEMENT_RELEASE_TYPE, game.releaseType());
 
     // Write other tags
-    writeOtherFields(game);
+    writeOtherFields(game, PlatformDoc::gameElements());
 
     // Close game tag
     mStreamWriter.writeEndElement();
+    endItem(game);
 
     // Return error status
     return !mStreamWriter.hasError();
@@ -394,6 +479,7 @@ bool PlatformDocWriter::writeAddApp(const AddApp& addApp)
 {
     // Write opening tag
     mStreamWriter.writeStartElement(Xml::Element_AddApp::NAME);
+    beginItem(Xml::Element_AddApp::NAME);
 
     // Write known tags
     writeCleanTextElement(Xml::Element_AddApp::ELEMENT_ID, addApp.id().toString(QUuid::WithoutBraces));
@@ -405,10 +491,11 @@ bool PlatformDocWriter::writeAddApp(const AddApp& addApp)
     writeCleanTextElement(Xml::Element_AddApp::ELEMENT_WAIT_FOR_EXIT, addApp.isWaitForExit() ? u"true"_s : u"false"_s);
 
     // Write other tags
-    writeOtherFields(addApp);
+    writeOtherFields(addApp, PlatformDoc::addAppElements());
 
     // Close additional app tag
     mStreamWriter.writeEndElement();
+    endItem(addApp);
 
     // Return error status
     return !mStreamWriter.hasError();
@@ -418,6 +505,7 @@ bool PlatformDocWriter::writeCustomField(const CustomField& customField)
 {
     // Write opening tag
     mStreamWriter.writeStartElement(Xml::Element_CustomField::NAME);
+    beginItem(Xml::Element_CustomField::NAME);
 
     // Write known tags
     writeCleanTextElement(Xml::Element_CustomField::ELEMENT_GAME_ID, customField.gameId().toString(QUuid::WithoutBraces));
@@ -425,15 +513,67 @@ bool PlatformDocWriter::writeCustomField(const CustomField& customField)
     writeCleanTextElement(Xml::Element_CustomField::ELEMENT_VALUE, customField.value());
 
     // Write other tags
-    writeOtherFields(customField);
+    writeOtherFields(customField, PlatformDoc::customFieldElements());
 
     // Close custom field tag
     mStreamWriter.writeEndElement();
+    endItem(customField);
 
     // Return error status
     return !mStreamWriter.hasError();
 }
 
+bool PlatformDocWriter::writeSnapshot()
+{
+    Lr::DocSnapshot snapshot(source()->path());
+    if(!snapshot.begin(PlatformDoc::SNAPSHOT_VERSION, outputHash()))
+        return false;
+
+    QDataStream& out = snapshot.stream();
+    auto writeItems = [&](const auto& items){
+        qint64 count = 0;
+        items.forEachFinal([&count](const auto&){ count++; });
+        out << count;
+
+        return items.forEachFinal([&](const auto& item){
+            std::optional<Span> span = itemSpan(item);
+            if(!span)
+                return false;
+
+            out << span->offset << span->length;
+            item.writeSnapshot(out);
+            return out.status() == QDataStream::Ok;
+        });
+    };
+
+    if(!writeItems(source()->mGames) || !writeItems(source()->mAddApps) || !writeItems(source()->mCustomFields))
+        return false;
+
+    return snapshot.commit();
+}
+
+//Public:
+Lr::DocHandlingError PlatformDocWriter::writeOutOf()
+{
+    // The snapshot must be reverted along with the doc
+    Import::BackupError bErr = Import::BackupManager::instance()->backupCopy(Lr::DocSnapshot(source()->path()).path());
+    if(bErr.type() == Import::BackupError::FileWontDelete)
+        return Lr::DocHandlingError(*source(), Lr::DocHandlingError::CantRemoveBackup);
+    else if(bErr.type() == Import::BackupError::FileWontBackup)
+        return Lr::DocHandlingError(*source(), Lr::DocHandlingError::CantCreateBackup);
+
+    Lr::DocHandlingError writeError = Lr::XmlDocWriter<PlatformDoc>::writeOutOf();
+    if(writeError.isValid())
+        return writeError;
+
+    // Snapshot the result so that the next import doesn't need to parse it, which needs the doc's final size and time
+    mXmlFile.close();
+    if(!writeSnapshot())
+        qWarning("Failed to snapshot platform doc %s", qPrintable(source()->path()));
+
+    return writeError;
+}
+
 //===============================================================================================================
 // PlaylistDoc
 //===============================================================================================================
@@ -505,54 +645,42 @@ Lr::DocHandlingError PlaylistDocReader::readTargetDoc()
 
 void PlaylistDocReader::parsePlaylistHeader()
 {
+    static const Lr::ElementDispatch<PlaylistHeader::Builder> dispatch{
+        {Xml::Element_PlaylistHeader::ELEMENT_ID, [](auto& b, auto& r){ b.wPlaylistId(r.readElementText()); }},
+        {Xml::Element_PlaylistHeader::ELEMENT_NAME, [](auto& b, auto& r){ b.wName(r.readElementText()); }},
+        {Xml::Element_PlaylistHeader::ELEMENT_NESTED_NAME, [](auto& b, auto& r){ b.wNestedName(r.readElementText()); }},
+        {Xml::Element_PlaylistHeader::ELEMENT_NOTES, [](auto& b, auto& r){ b.wNotes(r.readElementText()); }}
+    };
+
     // Playlist Header to Build
     PlaylistHeader::Builder phb;
 
     // Cover all children
-    while(mStreamReader.readNextStartElement())
-    {
-        if(mStreamReader.name() == Xml::Element_PlaylistHeader::ELEMENT_ID)
-            phb.wPlaylistId(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_PlaylistHeader::ELEMENT_NAME)
-            phb.wName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_PlaylistHeader::ELEMENT_NESTED_NAME)
-            phb.wNestedName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_PlaylistHeader::ELEMENT_NOTES)
-            phb.wNotes(mStreamReader.readElementText());
-        else
-            phb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
-    }
+    readChildElements(phb, dispatch);
 
     // Build Playlist Header and add to document
-    target()->mPlaylistHeader = phb.build();
+    target()->mPlaylistHeader = std::move(phb).build();
 }
 
 void PlaylistDocReader::parsePlaylistGame()
 {
+    static const Lr::ElementDispatch<PlaylistGame::Builder> dispatch{
+        {Xml::Element_PlaylistGame::ELEMENT_ID, [](auto& b, auto& r){ b.wGameId(r.readElementText()); }},
+        {Xml::Element_PlaylistGame::ELEMENT_GAME_TITLE, [](auto& b, auto& r){ b.wGameTitle(r.readElementText()); }},
+        {Xml::Element_PlaylistGame::ELEMENT_GAME_FILE_NAME, [](auto& b, auto& r){ b.wGameFileName(r.readElementText()); }},
+        {Xml::Element_PlaylistGame::ELEMENT_GAME_PLATFORM, [](auto& b, auto& r){ b.wGamePlatform(r.readElementText()); }},
+        {Xml::Element_PlaylistGame::ELEMENT_MANUAL_ORDER, [](auto& b, auto& r){ b.wManualOrder(r.readElementText()); }},
+        {Xml::Element_PlaylistGame::ELEMENT_LB_DB_ID, [](auto& b, auto& r){ b.wLBDatabaseId(r.readElementText()); }}
+    };
+
     // Playlist Game to Build
     PlaylistGame::Builder pgb;
 
     // Cover all children
-    while(mStreamReader.readNextStartElement())
-    {
-        if(mStreamReader.name() == Xml::Element_PlaylistGame::ELEMENT_ID)
-            pgb.wGameId(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_PlaylistGame::ELEMENT_GAME_TITLE)
-            pgb.wGameTitle(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_PlaylistGame::ELEMENT_GAME_FILE_NAME)
-            pgb.wGameFileName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_PlaylistGame::ELEMENT_GAME_PLATFORM)
-            pgb.wGamePlatform(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_PlaylistGame::ELEMENT_MANUAL_ORDER)
-            pgb.wManualOrder(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Xml::Element_PlaylistGame::ELEMENT_LB_DB_ID)
-            pgb.wLBDatabaseId(mStreamReader.readElementText());
-        else
-            pgb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
-    }
+    readChildElements(pgb, dispatch);
 
     // Build Playlist Game
-    PlaylistGame existingPlaylistGame = pgb.build();
+    PlaylistGame existingPlaylistGame = std::move(pgb).build();
 
     // Correct LB ID if it is invalid and then add it to tracker
     if(existingPlaylistGame.lbDatabaseId() < 0)
@@ -564,7 +692,7 @@ void PlaylistDocReader::parsePlaylistGame()
         target()->mLaunchBoxDatabaseIdTracker->reserve(existingPlaylistGame.lbDatabaseId());
 
     // Add to document
-    target()->mPlaylistGames.insert(existingPlaylistGame);
+    target()->mPlaylistGames.insert(std::move(existingPlaylistGame));
 }
 
 //===============================================================================================================
@@ -663,7 +791,7 @@ bool PlatformsConfigDoc::isEmpty() const
 void PlatformsConfigDoc::addPlatform(Platform&& platform)
 {
     // Add platform, don't need to add media folders as LB will automatically set them to the defaults
-    mPlatforms.insert(platform);
+    mPlatforms.insert(std::move(platform));
 }
 
 void PlatformsConfigDoc::removePlatform(const QString& name)
@@ -673,14 +801,14 @@ void PlatformsConfigDoc::removePlatform(const QString& name)
     removePlatformFolders(name);
 }
 
-void PlatformsConfigDoc::addPlatformFolder(PlatformFolder&& platformFolder) { mPlatformFolders.insert(platformFolder); }
+void PlatformsConfigDoc::addPlatformFolder(PlatformFolder&& platformFolder) { mPlatformFolders.insert(std::move(platformFolder)); }
 
 void PlatformsConfigDoc::removePlatformFolders(const QString& platformName)
 {
     mPlatformFolders.eraseIf([&platformName](const PlatformFolder& pf){ return pf.platform() == platformName; });
 }
 
-void PlatformsConfigDoc::addPlatformCategory(PlatformCategory&& platformCategory) { mPlatformCategories.insert(platformCategory); }
+void PlatformsConfigDoc::addPlatformCategory(PlatformCategory&& platformCategory) { mPlatformCategories.insert(std::move(platformCategory)); }
 
 void PlatformsConfigDoc::removePlatformCategory(const QString& categoryName) { mPlatformCategories.remove(categoryName); }
 
@@ -734,7 +862,7 @@ void PlatformsConfigDoc::Reader::parsePlatform()
     }
 
     // Build Platform and add to document
-    target()->mPlatforms.insert(pb.build());
+    target()->mPlatforms.insert(std::move(pb).build());
 }
 
 Lr::DocHandlingError PlatformsConfigDoc::Reader::parsePlatformFolder()
@@ -756,7 +884,7 @@ Lr::DocHandlingError PlatformsConfigDoc::Reader::parsePlatformFolder()
     }
 
     // Build PlatformFolder and add to document
-    target()->mPlatformFolders.insert(pfb.build());
+    target()->mPlatformFolders.insert(std::move(pfb).build());
 
     return Lr::DocHandlingError();
 }
@@ -778,7 +906,7 @@ void PlatformsConfigDoc::Reader::parsePlatformCategory()
     }
 
     // Build Playlist Header and add to document
-    target()->mPlatformCategories.insert(pcb.build());
+    target()->mPlatformCategories.insert(std::move(pcb).build());
 }
 
 //===============================================================================================================
@@ -880,11 +1008,49 @@ ParentsDoc::ParentsDoc(Install* install, const QString& xmlPath) :
 //Private:
 Lr::IDataDoc::Type ParentsDoc::type() const { return Lr::IDataDoc::Type::Config; }
 
+void ParentsDoc::indexParent(const Parent& parent, qsizetype idx)
+{
+    // Keep the first of any duplicates
+    auto indexFirst = [idx](auto& index, const auto& key){
+        if(!index.contains(key))
+            index.insert(key, idx);
+    };
+
+    // Normally only one kind of child is set per parent, but index whichever are present
+    QString parentCategory = parent.parentPlatformCategoryName();
+    if(QString pcn = parent.platformCategoryName(); !pcn.isEmpty())
+        indexFirst(mPlatformCategoryIndex, std::pair(pcn, parentCategory));
+    if(QString pn = parent.platformName(); !pn.isEmpty())
+        indexFirst(mPlatformIndex, std::pair(pn, parentCategory));
+    if(QUuid pId = parent.playlistId(); !pId.isNull())
+        indexFirst(mPlaylistIndex, std::pair(pId, parentCategory));
+}
+
+void ParentsDoc::rebuildIndexes()
+{
+    mPlatformCategoryIndex.clear();
+    mPlatformIndex.clear();
+    mPlaylistIndex.clear();
+
+    for(qsizetype i = 0; i < mParents.size(); i++)
+        indexParent(mParents.at(i), i);
+}
+
+void ParentsDoc::appendParent(Parent&& parent)
+{
+    indexParent(parent, mParents.size());
+    mParents.append(std::move(parent));
+}
+
 bool ParentsDoc::removeIfPresent(qsizetype idx)
 {
     if(idx != -1)
     {
+        /* Removal shifts every following entry and may uncover a duplicate that was hidden by the removed one,
+         * so just reindex. This only happens when correcting legacy layouts, which is rare.
+         */
         mParents.remove(idx);
+        rebuildIndexes();
         return true;
     }
 
@@ -893,38 +1059,17 @@ bool ParentsDoc::removeIfPresent(qsizetype idx)
 
 qsizetype ParentsDoc::findPlatformCategory(QStringView platformCategory, QStringView parentCategory) const
 {
-    for(auto i = 0; i < mParents.size(); i++)
-    {
-        auto p = mParents.at(i);
-        if(p.platformCategoryName() == platformCategory && p.parentPlatformCategoryName() == parentCategory)
-            return i;
-    }
-
-    return -1;
+    return mPlatformCategoryIndex.value({platformCategory.toString(), parentCategory.toString()}, -1);
 }
 
 qsizetype ParentsDoc::findPlatform(QStringView platform, QStringView parentCategory) const
 {
-    for(auto i = 0; i < mParents.size(); i++)
-    {
-        auto p = mParents.at(i);
-        if(p.platformName() == platform && p.parentPlatformCategoryName() == parentCategory)
-            return i;
-    }
-
-    return -1;
+    return mPlatformIndex.value({platform.toString(), parentCategory.toString()}, -1);
 }
 
 qsizetype ParentsDoc::findPlaylist(const QUuid& playlistId, QStringView parentCategory) const
 {
-    for(auto i = 0; i < mParents.size(); i++)
-    {
-        auto p = mParents.at(i);
-        if(p.playlistId() == playlistId && p.parentPlatformCategoryName() == parentCategory)
-            return i;
-    }
-
-    return -1;
+    return mPlaylistIndex.value({playlistId, parentCategory.toString()}, -1);
 }
 
 //Public:
@@ -940,7 +1085,7 @@ bool ParentsDoc::removePlaylist(const QUuid& playlistId, QStringView parentCateg
 
 const QList<Parent>& ParentsDoc::parents() const { return mParents; }
 
-void ParentsDoc::addParent(const Parent& parent) { mParents.append(parent); }
+void ParentsDoc::addParent(const Parent& parent) { appendParent(Parent(parent)); }
 
 //===============================================================================================================
 // ParentsDoc::Reader
@@ -989,8 +1134,7 @@ void ParentsDoc::Reader::parseParent()
     }
 
     // Build Platform and add to document
-    Parent existingParent = pb.build();
-    target()->mParents.append(existingParent);
+    target()->appendParent(std::move(pb).build());
 }
 
 //===============================================================================================================
@@ -3,9 +3,13 @@
 
 #pragma warning( disable : 4250 )
 
+// Standard Library Includes
+#include <utility>
+
 // Qt Includes
 #include <QString>
 #include <QFile>
+#include <QHash>
 
 // Qx Includes
 #include <qx/core/qx-freeindextracker.h>
@@ -22,14 +26,27 @@ class PlatformDoc : public Lr::BasicPlatformDoc<LauncherId>
 {
     friend PlatformDocReader;
     friend PlatformDocWriter;
+//-Class Variables-----------------------------------------------------------------------------------------------------
+private:
+    // Layout of the items in the doc's snapshot, bump when it changes
+    static inline const quint16 SNAPSHOT_VERSION = 1;
+
 //-Instance Variables--------------------------------------------------------------------------------------------------
 private:
     UpdatableContainer<CustomField> mCustomFields;
+    QByteArray mSourceXml; // Backs the original markup of read entries
 
 //-Constructor--------------------------------------------------------------------------------------------------------
 public:
     explicit PlatformDoc(Install* install, const QString& xmlPath, const QString& docName, const Import::UpdateOptions& updateOptions);
 
+//-Class Functions----------------------------------------------------------------------------------------------------
+private:
+    // Known elements, shared by the reader and writer
+    static const Lr::ElementDispatch<Game::Builder>& gameElements();
+    static const Lr::ElementDispatch<AddApp::Builder>& addAppElements();
+    static const Lr::ElementDispatch<CustomField::Builder>& customFieldElements();
+
 //-Instance Functions--------------------------------------------------------------------------------------------------
 private:
     Game prepareGame(const Fp::Game& game) override;
@@ -51,10 +68,14 @@ public:
 
 //-Instance Functions-------------------------------------------------------------------------------------------------
 private:
+    bool readSnapshot();
     Lr::DocHandlingError readTargetDoc() override;
     void parseGame();
     void parseAddApp();
     void parseCustomField();
+
+public:
+    Lr::DocHandlingError readInto() override;
 };
 
 class PlatformDocWriter : public Lr::XmlDocWriter<PlatformDoc>
@@ -69,6 +90,10 @@ private:
     bool writeGame(const Game& game);
     bool writeAddApp(const AddApp& addApp);
     bool writeCustomField(const CustomField& customField);
+    bool writeSnapshot();
+
+public:
+    Lr::DocHandlingError writeOutOf() override;
 };
 
 class PlaylistDoc : public Lr::BasicPlaylistDoc<LauncherId>
@@ -196,6 +221,13 @@ public:
 private:
     QList<Parent> mParents;
 
+    /* Indexes into mParents, key'ed with the child and the parent category. Only the first of any duplicate
+     * entries is indexed, which matches what a front-to-back search would find.
+     */
+    QHash<std::pair<QString, QString>, qsizetype> mPlatformCategoryIndex;
+    QHash<std::pair<QString, QString>, qsizetype> mPlatformIndex;
+    QHash<std::pair<QUuid, QString>, qsizetype> mPlaylistIndex;
+
 //-Constructor--------------------------------------------------------------------------------------------------------
 public:
     explicit ParentsDoc(Install* install, const QString& xmlPath);
@@ -203,6 +235,9 @@ public:
 //-Instance Functions--------------------------------------------------------------------------------------------------
 private:
     Type type() const override;
+    void indexParent(const Parent& parent, qsizetype idx);
+    void rebuildIndexes();
+    void appendParent(Parent&& parent);
     bool removeIfPresent(qsizetype idx);
 
     qsizetype findPlatformCategory(QStringView platformCategory, QStringView parentCategory) const;
@@ -88,6 +88,11 @@ Qx::Error Install::populateExistingDocs(QSet<Lr::IDataDoc::Identifier>& existing
     return Qx::Error();
 }
 
+QStringList Install::existingDocWatchPaths() const
+{
+    return {mPlatformsDirectory.absolutePath(), mPlaylistsDirectory.absolutePath(), mDataDirectory.absolutePath()};
+}
+
 void Install::editBulkImageReferences(const Import::ImagePaths& imageSources)
 {
     // Set media folder paths
@@ -255,6 +260,7 @@ void Install::softReset()
 
 QList<Import::ImageMode> Install::preferredImageModeOrder() const { return IMAGE_MODE_ORDER; }
 bool Install::isRunning() const { return Qx::processIsRunning(mExeFile.fileName()); }
+bool Install::usesGameTags() const { return false; }
 
 QString Install::versionString() const
 {
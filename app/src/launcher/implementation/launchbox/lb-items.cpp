@@ -17,19 +17,19 @@ Game::Game() {}
 Game::Game(const Fp::Game& flashpointGame, const QString& fullCLIFpPath) :
     Lr::Game(flashpointGame.id(), flashpointGame.title(), flashpointGame.platformName()),
     mSeries(flashpointGame.series()),
-    mDeveloper(flashpointGame.developer()),
-    mPublisher(flashpointGame.publisher()),
+    mDeveloper(Import::StringPool::intern(flashpointGame.developer())),
+    mPublisher(Import::StringPool::intern(flashpointGame.publisher())),
     mSortTitle(flashpointGame.orderTitle()),
     mDateAdded(flashpointGame.dateAdded()),
     mDateModified(flashpointGame.dateModified()),
     mBroken(flashpointGame.isBroken()),
-    mPlayMode(flashpointGame.playMode()),
-    mStatus(flashpointGame.status()),
+    mPlayMode(Import::StringPool::intern(flashpointGame.playMode())),
+    mStatus(Import::StringPool::intern(flashpointGame.status())),
     mRegion(), // Ensures this field is cleared because of older tool versions
     mNotes(flashpointGame.originalDescription() +
            (!flashpointGame.notes().isEmpty() ? u"\n\n"_s + flashpointGame.notes() : u""_s)),
-    mSource(flashpointGame.source()),
-    mAppPath(QDir::toNativeSeparators(fullCLIFpPath)),
+    mSource(Import::StringPool::intern(flashpointGame.source())),
+    mAppPath(Import::StringPool::intern(QDir::toNativeSeparators(fullCLIFpPath))),
     mCommandLine(CLIFp::parametersFromStandard(flashpointGame.id())),
     mReleaseDate(flashpointGame.releaseDate()),
     mVersion(flashpointGame.version()),
@@ -57,6 +57,33 @@ QDateTime Game::releaseDate() const { return mReleaseDate; }
 QString Game::version() const { return mVersion; }
 QString Game::releaseType() const { return mReleaseType; }
 
+void Game::writeSnapshot(QDataStream& out) const
+{
+    out << mId << mName << mPlatform << mSeries << mDeveloper << mPublisher << mSortTitle << mDateAdded << mDateModified
+        << mBroken << mPlayMode << mStatus << mRegion << mNotes << mSource << mAppPath << mCommandLine << mReleaseDate
+        << mVersion << mReleaseType;
+}
+
+void Game::readSnapshot(QDataStream& in, QByteArrayView originalMarkup)
+{
+    in >> mId >> mName >> mPlatform >> mSeries >> mDeveloper >> mPublisher >> mSortTitle >> mDateAdded >> mDateModified
+       >> mBroken >> mPlayMode >> mStatus >> mRegion >> mNotes >> mSource >> mAppPath >> mCommandLine >> mReleaseDate
+       >> mVersion >> mReleaseType;
+
+    // Share the same strings the builder does
+    mPlatform = Import::StringPool::intern(mPlatform);
+    mDeveloper = Import::StringPool::intern(mDeveloper);
+    mPublisher = Import::StringPool::intern(mPublisher);
+    mPlayMode = Import::StringPool::intern(mPlayMode);
+    mStatus = Import::StringPool::intern(mStatus);
+    mSource = Import::StringPool::intern(mSource);
+    mAppPath = Import::StringPool::intern(mAppPath);
+    mReleaseType = Import::StringPool::intern(mReleaseType);
+
+    mOriginalMarkup = originalMarkup;
+    mUnmodifiedOriginal = true;
+}
+
 //===============================================================================================================
 // Game::Builder
 //===============================================================================================================
@@ -69,8 +96,8 @@ Game::Builder::Builder() {}
 //Public:
 Game::Builder& Game::Builder::wTitle(const QString& title) { mBlueprint.mName = title; return *this; } // Proxy for name
 Game::Builder& Game::Builder::wSeries(const QString& series) { mBlueprint.mSeries = series; return *this; }
-Game::Builder& Game::Builder::wDeveloper(const QString& developer) { mBlueprint.mDeveloper = developer; return *this; }
-Game::Builder& Game::Builder::wPublisher(const QString& publisher) { mBlueprint.mPublisher = publisher; return *this; }
+Game::Builder& Game::Builder::wDeveloper(const QString& developer) { mBlueprint.mDeveloper = Import::StringPool::intern(developer); return *this; }
+Game::Builder& Game::Builder::wPublisher(const QString& publisher) { mBlueprint.mPublisher = Import::StringPool::intern(publisher); return *this; }
 Game::Builder& Game::Builder::wSortTitle(const QString& sortTitle) { mBlueprint.mSortTitle = sortTitle; return *this; }
 
 Game::Builder& Game::Builder::wDateAdded(const QString& rawDateAdded)
@@ -86,12 +113,12 @@ Game::Builder& Game::Builder::wDateModified(const QString& rawDateModified)
 }
 
 Game::Builder& Game::Builder::wBroken(const QString& rawBroken) { mBlueprint.mBroken = rawBroken.toInt() != 0; return *this; }
-Game::Builder& Game::Builder::wPlayMode(const QString& playMode) { mBlueprint.mPlayMode = playMode; return *this; }
-Game::Builder& Game::Builder::wStatus(const QString& status) { mBlueprint.mStatus = status; return *this; }
+Game::Builder& Game::Builder::wPlayMode(const QString& playMode) { mBlueprint.mPlayMode = Import::StringPool::intern(playMode); return *this; }
+Game::Builder& Game::Builder::wStatus(const QString& status) { mBlueprint.mStatus = Import::StringPool::intern(status); return *this; }
 Game::Builder& Game::Builder::wRegion(const QString& region) { mBlueprint.mRegion = region; return *this; }
 Game::Builder& Game::Builder::wNotes(const QString& notes) { mBlueprint.mNotes = notes; return *this; }
-Game::Builder& Game::Builder::wSource(const QString& source) { mBlueprint.mSource = source; return *this; }
-Game::Builder& Game::Builder::wAppPath(const QString& appPath) { mBlueprint.mAppPath = appPath; return *this; }
+Game::Builder& Game::Builder::wSource(const QString& source) { mBlueprint.mSource = Import::StringPool::intern(source); return *this; }
+Game::Builder& Game::Builder::wAppPath(const QString& appPath) { mBlueprint.mAppPath = Import::StringPool::intern(appPath); return *this; }
 Game::Builder& Game::Builder::wCommandLine(const QString& commandLine) { mBlueprint.mCommandLine = commandLine; return *this; }
 
 Game::Builder& Game::Builder::wReleaseDate(const QString& rawReleaseDate)
@@ -101,7 +128,7 @@ Game::Builder& Game::Builder::wReleaseDate(const QString& rawReleaseDate)
 }
 
 Game::Builder& Game::Builder::wVersion(const QString& version) { mBlueprint.mVersion = version; return *this; }
-Game::Builder& Game::Builder::wReleaseType(const QString& releaseType) { mBlueprint.mReleaseType = releaseType; return *this; }
+Game::Builder& Game::Builder::wReleaseType(const QString& releaseType) { mBlueprint.mReleaseType = Import::StringPool::intern(releaseType); return *this; }
 
 //===============================================================================================================
 // AddApp
@@ -113,7 +140,7 @@ AddApp::AddApp() {}
 
 AddApp::AddApp(const Fp::AddApp& flashpointAddApp, const QString& fullCLIFpPath) :
     Lr::AddApp(flashpointAddApp.id(), flashpointAddApp.name(), flashpointAddApp.parentGameId()),
-    mAppPath(QDir::toNativeSeparators(fullCLIFpPath)),
+    mAppPath(Import::StringPool::intern(QDir::toNativeSeparators(fullCLIFpPath))),
     mCommandLine(CLIFp::parametersFromStandard(mId)),
     mAutorunBefore(false),
     mWaitForExit(flashpointAddApp.isWaitForExit())
@@ -126,6 +153,20 @@ QString AddApp::commandLine() const { return mCommandLine; }
 bool AddApp::isAutorunBefore() const { return mAutorunBefore; }
 bool AddApp::isWaitForExit() const { return mWaitForExit; }
 
+void AddApp::writeSnapshot(QDataStream& out) const
+{
+    out << mId << mName << mGameId << mAppPath << mCommandLine << mAutorunBefore << mWaitForExit;
+}
+
+void AddApp::readSnapshot(QDataStream& in, QByteArrayView originalMarkup)
+{
+    in >> mId >> mName >> mGameId >> mAppPath >> mCommandLine >> mAutorunBefore >> mWaitForExit;
+    mAppPath = Import::StringPool::intern(mAppPath); // Share the same string the builder does
+
+    mOriginalMarkup = originalMarkup;
+    mUnmodifiedOriginal = true;
+}
+
 //===============================================================================================================
 // AddApp::Builder
 //===============================================================================================================
@@ -136,7 +177,7 @@ AddApp::Builder::Builder() {}
 
 //-Instance Functions------------------------------------------------------------------------------------------
 //Public:
-AddApp::Builder& AddApp::Builder::wAppPath(const QString& appPath) { mBlueprint.mAppPath = appPath; return *this; }
+AddApp::Builder& AddApp::Builder::wAppPath(const QString& appPath) { mBlueprint.mAppPath = Import::StringPool::intern(appPath); return *this; }
 AddApp::Builder& AddApp::Builder::wCommandLine(const QString& commandLine) { mBlueprint.mCommandLine = commandLine; return *this; }
 AddApp::Builder& AddApp::Builder::wAutorunBefore(const QString& rawAutorunBefore) { mBlueprint.mAutorunBefore = rawAutorunBefore != u"0"_s; return *this; }
 AddApp::Builder& AddApp::Builder::wWaitForExit(const QString& rawWaitForExit) { mBlueprint.mWaitForExit = rawWaitForExit != u"0"_s; return *this; }
@@ -155,6 +196,16 @@ QUuid CustomField::gameId() const { return mGameId; }
 QString CustomField::name() const { return mName; }
 QString CustomField::value() const { return mValue; }
 
+void CustomField::writeSnapshot(QDataStream& out) const { out << mGameId << mName << mValue; }
+
+void CustomField::readSnapshot(QDataStream& in, QByteArrayView originalMarkup)
+{
+    in >> mGameId >> mName >> mValue;
+
+    mOriginalMarkup = originalMarkup;
+    mUnmodifiedOriginal = true;
+}
+
 //===============================================================================================================
 // CustomField::Builder
 //===============================================================================================================
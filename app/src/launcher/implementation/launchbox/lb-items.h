@@ -5,6 +5,7 @@
 #include <QString>
 #include <QDateTime>
 #include <QSet>
+#include <QDataStream>
 
 // libfp Includes
 #include <fp/fp-items.h>
@@ -66,6 +67,10 @@ public:
     QDateTime releaseDate() const;
     QString version() const;
     QString releaseType() const;
+
+    // For platform doc snapshots, the markup is as in the snapshotted doc
+    void writeSnapshot(QDataStream& out) const;
+    void readSnapshot(QDataStream& in, QByteArrayView originalMarkup);
 };
 
 class Game::Builder : public Lr::Game::Builder<Game>
@@ -120,6 +125,10 @@ public:
     QString commandLine() const;
     bool isAutorunBefore() const;
     bool isWaitForExit() const;
+
+    // For platform doc snapshots, the markup is as in the snapshotted doc
+    void writeSnapshot(QDataStream& out) const;
+    void readSnapshot(QDataStream& in, QByteArrayView originalMarkup);
 };
 
 class AddApp::Builder : public Lr::AddApp::Builder<AddApp>
@@ -163,6 +172,10 @@ public:
     QUuid gameId() const;
     QString name() const;
     QString value() const;
+
+    // For platform doc snapshots, the markup is as in the snapshotted doc
+    void writeSnapshot(QDataStream& out) const;
+    void readSnapshot(QDataStream& in, QByteArrayView originalMarkup);
 };
 
 struct CustomField::Hash
@@ -165,6 +165,9 @@ IUpdatableDoc::IUpdatableDoc(IInstall* install, const QString& docPath, const QS
 {}
 
 //-Instance Functions--------------------------------------------------------------------------------------------------
+//Protected:
+std::pmr::memory_resource* IUpdatableDoc::itemArena() const { return &mItemArena; }
+
 //Public:
 void IUpdatableDoc::postCheckout() { mUpdating = true; }
 
@@ -3,7 +3,9 @@
 
 // Standard Library Includes
 #include <concepts>
-#include <unordered_set>
+#include <deque>
+#include <memory_resource>
+#include <vector>
 
 // Qt Includes
 #include <QFile>
@@ -241,6 +243,11 @@ protected:
 private:
     bool mUpdating;
 
+    /* Backs the storage of the doc's item containers, which is then released all at once along with the doc
+     * instead of piece by piece. Memory given back before then isn't reused, but containers only grow.
+     */
+    mutable std::pmr::monotonic_buffer_resource mItemArena;
+
 protected:
     Import::UpdateOptions mUpdateOptions;
 
@@ -250,6 +257,9 @@ protected:
     explicit IUpdatableDoc(IInstall* install, const QString& docPath, const QString& docName, const Import::UpdateOptions& updateOptions);
 
 //-Instance Functions--------------------------------------------------------------------------------------------------
+protected:
+    std::pmr::memory_resource* itemArena() const;
+
 public:
     virtual void postCheckout() override;
 };
@@ -279,90 +289,207 @@ concept CustomizedUpdateableContainer = HasHash<C> && HasKeyEqual<C>;
  *
  * Items derived from BasicItem are supported by default and use their id() for comparison/hashing
  *
+ * Every item is stored once, in insertion order, alongside a tag for which stage of the update it's in, and is looked
+ * up through a flat open addressing (linear probing) index. Entries are never moved or freed until the container is
+ * destroyed (removal just tags them), so pointers returned by insert() stay valid and a removed item that's inserted
+ * again reuses its old entry.
  */
 
 template<typename Data>
 class IUpdatableDoc::UpdatableContainer
 {
     template<typename D>
-    struct storage{ using type = std::unordered_set<D>; };
+    struct traits{ using Hash = std::hash<D>; using KeyEqual = std::equal_to<D>; };
 
     template<CustomizedUpdateableContainer D>
-    struct storage<D>{ using type = std::unordered_set<D, typename D::Hash, typename D::KeyEqual>; };
+    struct traits<D>{ using Hash = typename D::Hash; using KeyEqual = typename D::KeyEqual; };
+
+    using Hash = traits<Data>::Hash;
+    using KeyEqual = traits<Data>::KeyEqual;
+
+//-Inner Classes--------------------------------------------------------------------------------------------------
+private:
+    // Existing entries are the obsolete ones after updates are complete if 'remove obsolete entries' is enabled
+    enum class State : quint8 { Existing, Updated, New, Removed };
+
+    struct Entry
+    {
+        Data data;
+        State state;
+    };
+
+//-Class Variables--------------------------------------------------------------------------------------------------
+private:
+    static inline const qsizetype EMPTY_SLOT = -1;
+    static inline const qsizetype MIN_SLOTS = 16;
 
-    using Storage = storage<Data>::type;
 //-Instance Variables--------------------------------------------------------------------------------------------------
 private:
     const IUpdatableDoc* mDoc;
-    Storage mExisting; // Holds obsolete entries after updates are complete if 'remove obsolete entries' is enabled
-    Storage mUpdated;
-    Storage mNew;
+    std::pmr::deque<Entry> mEntries;
+    std::pmr::vector<qsizetype> mSlots; // Indices into mEntries, size is always a power of two
+    qsizetype mCount; // Entries that aren't removed
 
 //-Constructor--------------------------------------------------------------------------------------------------------
 public:
-    explicit UpdatableContainer(const IUpdatableDoc* doc) : mDoc(doc) {}
+    explicit UpdatableContainer(const IUpdatableDoc* doc) :
+        mDoc(doc),
+        mEntries(doc->itemArena()),
+        mSlots(doc->itemArena()),
+        mCount(0)
+    {}
 
-//-Class Functions--------------------------------------------------------------------------------------------------
+//-Instance Functions--------------------------------------------------------------------------------------------------
 private:
-    template<typename F>
-    static auto forEach(F&& f, const Storage& s)
+    bool isObsolete(State s) const { return s == State::Existing && mDoc->mUpdateOptions.removeObsolete; }
+    bool isFinal(State s) const { return s == State::Updated || s == State::New || (s == State::Existing && !mDoc->mUpdateOptions.removeObsolete); }
+
+    template<typename T>
+    std::size_t slotOf(const T& key, const std::pmr::vector<qsizetype>& slots) const
+    {
+        // Finds the slot that holds the key, or the empty one it would go in
+        std::size_t mask = slots.size() - 1;
+        std::size_t s = Hash{}(key) & mask;
+        while(slots[s] != EMPTY_SLOT && !KeyEqual{}(key, mEntries[slots[s]].data))
+            s = (s + 1) & mask;
+
+        return s;
+    }
+
+    void growIfNeeded()
     {
-        for(const auto& e : s)
+        // Keep the load factor at or below 1/2 so that probe runs stay short
+        if((std::ssize(mEntries) + 1) * 2 <= std::ssize(mSlots))
+            return;
+
+        std::pmr::vector<qsizetype> slots(std::max(MIN_SLOTS, std::ssize(mSlots) * 2), EMPTY_SLOT, mSlots.get_allocator());
+        for(qsizetype i = 0; i < std::ssize(mEntries); i++)
+            slots[slotOf(mEntries[i].data, slots)] = i;
+
+        mSlots = std::move(slots);
+    }
+
+    template<typename T>
+    const Entry* lookup(const T& key) const
+    {
+        if(mSlots.empty())
+            return nullptr;
+
+        qsizetype i = mSlots[slotOf(key, mSlots)];
+        return i != EMPTY_SLOT && mEntries[i].state != State::Removed ? &mEntries[i] : nullptr;
+    }
+
+    template<typename T>
+    Entry* lookup(const T& key) { return const_cast<Entry*>(std::as_const(*this).lookup(key)); }
+
+    template<typename T>
+    std::pair<Entry*, bool> tryAdd(T&& d, State state)
+    {
+        // Only consumes 'd' if it was added
+        growIfNeeded();
+        qsizetype& slot = mSlots[slotOf(d, mSlots)];
+        if(slot == EMPTY_SLOT)
         {
+            slot = std::ssize(mEntries);
+            mEntries.push_back(Entry{.data = std::forward<T>(d), .state = state});
+            mCount++;
+            return {&mEntries.back(), true};
+        }
+
+        Entry& e = mEntries[slot];
+        if(e.state != State::Removed)
+            return {&e, false};
+
+        e.data = std::forward<T>(d);
+        e.state = state;
+        mCount++;
+        return {&e, true};
+    }
+
+    void markRemoved(Entry& e)
+    {
+        e.state = State::Removed;
+        mCount--;
+    }
+
+    template<typename T, typename S>
+    bool removeIf(const T& key, S&& selected)
+    {
+        Entry* e = lookup(key);
+        if(!e || !selected(e->state))
+            return false;
+
+        markRemoved(*e);
+        return true;
+    }
+
+    template<typename T, typename S>
+    const Data* findIf(const T& key, S&& selected) const
+    {
+        const Entry* e = lookup(key);
+        return e && selected(e->state) ? &e->data : nullptr;
+    }
+
+    template<typename F, typename S>
+    auto forEachIf(F&& f, S&& selected) const
+    {
+        for(const Entry& e : mEntries)
+        {
+            if(!selected(e.state))
+                continue;
+
             if constexpr(std::predicate<F, Data>)
             {
-                if(!f(e))
+                if(!f(e.data))
                     return false;
             }
             else
-                f(e);
+                f(e.data);
         }
 
         if constexpr(std::predicate<F, Data>)
             return true;
     }
 
-    template<typename F, typename... Stores>
-    static auto allForEach(F&& f, Stores&&... stores)
+    template<typename P, typename S>
+    qsizetype eraseIf(P&& p, S&& selected)
     {
-        if constexpr(std::predicate<F, Data>)
-            return (forEach(f, stores) && ...);
-        else
-            ((forEach(f, stores)), ...);
+        qsizetype c = 0;
+        for(Entry& e : mEntries)
+        {
+            if(e.state != State::Removed && selected(e.state) && p(std::as_const(e.data)))
+            {
+                markRemoved(e);
+                c++;
+            }
+        }
+
+        return c;
     }
 
-//-Instance Functions--------------------------------------------------------------------------------------------------
-private:
     template<typename T>
-    const Data* insertInit(T&& d) { return &(*mExisting.insert(std::forward<T>(d)).first); }
+    const Data* insertInit(T&& d) { return &tryAdd(std::forward<T>(d), State::Existing).first->data; }
 
     template<typename T>
     const Data* insertMod(T&& d)
     {
-        // This could benefit from move semantics if QSet ever adds them, otherwise could use std::unordered_set
-        auto ex = mExisting.find(d);
-        if(ex == mExisting.end())
-            return &(*mNew.insert(std::forward<T>(d)).first);
-        else
+        auto [e, added] = tryAdd(std::forward<T>(d), State::New);
+        if(!added && e->state == State::Existing)
         {
-            const Data* inserted;
-
             // Replace if NewAndExisting, otherwise retain exact original
             if(mDoc->mUpdateOptions.importMode == Import::UpdateMode::NewAndExisting)
             {
                 // Special case for Items (copy other fields)
                 if constexpr(item<Data>)
-                    d.copyOtherFields(*ex);
+                    d.copyOtherFields(e->data);
 
-                inserted = &(*mUpdated.insert(std::forward<T>(d)).first);
+                e->data = std::forward<T>(d);
             }
-            else
-                inserted = &(*mUpdated.insert(*ex).first);
-
-            mExisting.erase(ex);
 
-            return inserted;
+            e->state = State::Updated;
         }
+
+        return &e->data;
     }
 
 public:
@@ -385,169 +512,79 @@ public:
      */
 
     template<typename T>
-    bool containsExisting(T&& t) const { return mExisting.contains(std::forward<T>(t)); }
+    bool containsExisting(const T& t) const { return findExisting(t); }
 
     template<typename T>
-    bool containsObsolete(T&& t) const { return mDoc->mUpdateOptions.removeObsolete && mExisting.contains(std::forward<T>(t)); }
+    bool containsObsolete(const T& t) const { return findObsolete(t); }
 
     template<typename T>
-    bool containsNew(T&& t) const { return mNew.contains(std::forward<T>(t)); }
+    bool containsNew(const T& t) const { return findNew(t); }
 
     template<typename T>
-    bool containsFinal(T&& t) const
-    {
-        return (!mDoc->mUpdateOptions.removeObsolete && mExisting.contains(std::forward<T>(t))) ||
-               mUpdated.contains(std::forward<T>(t)) ||
-               mNew.contains(std::forward<T>(t));
-    }
+    bool containsFinal(const T& t) const { return findFinal(t); }
 
     template<typename T>
-    bool contains(T&& t) const { return mExisting.contains(std::forward<T>(t)) || mUpdated.contains(std::forward<T>(t)) || mNew.contains(std::forward<T>(t)); }
+    bool contains(const T& t) const { return lookup(t); }
 
     template<typename T>
-    const Data* findExisting(T&& t) const
-    {
-        auto itr = mExisting.find(std::forward<T>(t));
-        return itr != mExisting.end() ? &(*itr) : nullptr;
-    }
+    const Data* findExisting(const T& t) const { return findIf(t, [](State s){ return s == State::Existing; }); }
 
     template<typename T>
-    const Data* findObsolete(T&& t) const
-    {
-        auto itr = mDoc->mUpdateOptions.removeObsolete ? mExisting.find(std::forward<T>(t)) : mExisting.end();
-        return itr != mExisting.end() ? &(*itr) : nullptr;
-    }
+    const Data* findObsolete(const T& t) const { return findIf(t, [this](State s){ return isObsolete(s); }); }
 
     template<typename T>
-    const Data* findNew(T&& t) const
-    {
-        auto itr = mNew.find(std::forward<T>(t));
-        return itr != mNew.end() ? &(*itr) : nullptr;
-    }
+    const Data* findNew(const T& t) const { return findIf(t, [](State s){ return s == State::New; }); }
 
     template<typename T>
-    const Data* findFinal(T&& t) const
-    {
-        auto itr = !mDoc->mUpdateOptions.removeObsolete ? mExisting.find(std::forward<T>(t)) : mExisting.end();
-        if(itr != mExisting.end())
-            return &(*itr);
-
-        itr = mUpdated.find(std::forward<T>(t));
-        if(itr != mExisting.end())
-            return &(*itr);
-
-        itr = mNew.find(std::forward<T>(t));
-        return itr != mExisting.end() ? &(*itr) : nullptr;
-    }
+    const Data* findFinal(const T& t) const { return findIf(t, [this](State s){ return isFinal(s); }); }
 
     template<typename T>
-    const Data* find(T&& t) const
-    {
-        auto itr = mExisting.find(std::forward<T>(t));
-        if(itr != mExisting.end())
-            return &(*itr);
-
-        itr = mUpdated.find(std::forward<T>(t));
-        if(itr != mExisting.end())
-            return &(*itr);
-
-        itr = mNew.find(std::forward<T>(t));
-        return itr != mExisting.end() ? &(*itr) : nullptr;
-    }
+    const Data* find(const T& t) const { return findIf(t, [](State){ return true; }); }
 
     template<typename T>
-    bool removeExisting(T&& t) { return mExisting.erase(std::forward<T>(t)); }
+    bool removeExisting(const T& t) { return removeIf(t, [](State s){ return s == State::Existing; }); }
 
     template<typename T>
-    bool removeObsolete(T&& t) { return mDoc->mUpdateOptions.removeObsolete && mExisting.erase(std::forward<T>(t)); }
+    bool removeObsolete(const T& t) { return removeIf(t, [this](State s){ return isObsolete(s); }); }
 
     template<typename T>
-    bool removeNew(T&& t) { return mNew.erase(std::forward<T>(t)); }
+    bool removeNew(const T& t) { return removeIf(t, [](State s){ return s == State::New; }); }
 
     template<typename T>
-    bool removeFinal(T&& t)
-    {
-        return (!mDoc->mUpdateOptions.removeObsolete && mExisting.erase(std::forward<T>(t))) ||
-               mUpdated.erase(std::forward<T>(t)) ||
-               mNew.erase(std::forward<T>(t));
-    }
+    bool removeFinal(const T& t) { return removeIf(t, [this](State s){ return isFinal(s); }); }
 
     template<typename T>
-    bool remove(T&& t) { return mExisting.erase(std::forward<T>(t)) || mUpdated.erase(std::forward<T>(t)) || mNew.erase(std::forward<T>(t)); }
+    bool remove(const T& t) { return removeIf(t, [](State){ return true; }); }
 
     /* TODO: For now we use a return of auto to allow halting early if the functor is a predicate  but in the long run it would be more flexible to create
      * an iterator type for each category (obsolete, new, final, etc.), but of course that would be annoying. Could try to have some kind of base class that handles
      * most of the tasks with just an override for increment/decrement
      */
     template<typename F>
-    auto forEachExisting(F&& f) const
-    {
-        return allForEach(f, mExisting);
-    }
+    auto forEachExisting(F&& f) const { return forEachIf(f, [](State s){ return s == State::Existing; }); }
 
     template<typename F>
-    auto forEachObsolete(F&& f) const
-    {
-        if(mDoc->mUpdateOptions.removeObsolete)
-            return allForEach(f, mExisting);
-        else if constexpr(std::predicate<F, Data>)
-            return true;
-    }
+    auto forEachObsolete(F&& f) const { return forEachIf(f, [this](State s){ return isObsolete(s); }); }
 
     template<typename F>
-    auto forEachNew(F&& f) const
-    {
-        return allForEach(f, mNew);
-    }
+    auto forEachNew(F&& f) const { return forEachIf(f, [](State s){ return s == State::New; }); }
 
     template<typename F>
-    auto forEachFinal(F&& f) const
-    {
-        if(!mDoc->mUpdateOptions.removeObsolete)
-            return allForEach(f, mExisting, mUpdated, mNew);
-        else
-            return allForEach(f, mUpdated, mNew);
-    }
+    auto forEachFinal(F&& f) const { return forEachIf(f, [this](State s){ return isFinal(s); }); }
 
     template<typename P>
-    Storage::size_type eraseObsoleteIf(P&& p)
-    {
-        if(mDoc->mUpdateOptions.removeObsolete)
-            return std::erase_if(mExisting, p);
-
-        return 0;
-    }
+    qsizetype eraseObsoleteIf(P&& p) { return eraseIf(p, [this](State s){ return isObsolete(s); }); }
 
     template<typename P>
-    Storage::size_type eraseNewIf(P&& p) { return std::erase_if(mNew, p); }
+    qsizetype eraseNewIf(P&& p) { return eraseIf(p, [](State s){ return s == State::New; }); }
 
     template<typename P>
-    Storage::size_type eraseFinalIf(P&& p)
-    {
-        typename Storage::size_type c = 0;
-
-        if(!mDoc->mUpdateOptions.removeObsolete)
-            c += std::erase_if(mExisting, p);
-
-        c += std::erase_if(mUpdated, p);
-        c += std::erase_if(mNew, p);
-
-        return c;
-    }
+    qsizetype eraseFinalIf(P&& p) { return eraseIf(p, [this](State s){ return isFinal(s); }); }
 
     template<typename P>
-    Storage::size_type eraseIf(P&& p)
-    {
-        typename Storage::size_type c = 0;
-
-        c += std::erase_if(mExisting, p);
-        c += std::erase_if(mUpdated, p);
-        c += std::erase_if(mNew, p);
-
-        return c;
-    }
+    qsizetype eraseIf(P&& p) { return eraseIf(p, [](State){ return true; }); }
 
-    bool isEmpty() const { return mExisting.empty() && mUpdated.empty() && mNew.empty(); }
+    bool isEmpty() const { return mCount == 0; }
 };
 
 class IPlatformDoc : public IUpdatableDoc
@@ -1,6 +1,12 @@
 // Unit Include
 #include "lr-install-interface.h"
 
+// Qt Includes
+#include <QtConcurrent>
+#include <QCoreApplication>
+#include <QDirIterator>
+#include <QThread>
+
 // Project Includes
 #include "import/backup.h"
 
@@ -14,24 +20,60 @@ namespace Lr
 //-Constructor---------------------------------------------------------------------------------------------------
 IInstall::IInstall(const QString& installPath) :
     mValid(false), // Path is invalid until proven otherwise
-    mRootDirectory(installPath)
+    mRootDirectory(installPath),
+    mExistingDocsStale(true)
 {}
 
 //-Destructor------------------------------------------------------------------------------------------------
 //Public:
-IInstall::~IInstall() {}
+IInstall::~IInstall() { discardPrefetchedDocs(); }
+
+//-Class Functions--------------------------------------------------------------------------------------------
+//Private:
+QStringList IInstall::expandWatchPaths(const QStringList& roots)
+{
+    QSet<QString> paths;
+
+    for(const QString& root : roots)
+    {
+        // A root that doesn't exist yet couldn't report its own creation
+        QFileInfo rootInfo(root);
+        if(!rootInfo.exists())
+            return {};
+
+        paths.insert(rootInfo.absoluteFilePath());
+
+        // Changes are only reported for the immediate contents of a directory
+        if(rootInfo.isDir())
+        {
+            QDirIterator subDirs(root, QDir::Dirs | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+            while(subDirs.hasNext())
+                paths.insert(subDirs.nextFileInfo().absoluteFilePath());
+        }
+    }
+
+    return paths.values();
+}
 
 //-Instance Functions--------------------------------------------------------------------------------------------
 //Private:
 bool IInstall::containsAnyDataDoc(IDataDoc::Type type, const QList<QString>& names) const
 {
-    // Create identifier set of names
-    QSet<IDataDoc::Identifier> searchSet;
     for(const QString& docName : names)
-        searchSet << IDataDoc::Identifier(type, translateDocName(docName, type));
+        if(mExistingDocuments.contains(IDataDoc::Identifier(type, translatedDocName(docName, type))))
+            return true;
+
+    return false;
+}
+
+QList<bool> IInstall::containsDataDocs(IDataDoc::Type type, const QList<QString>& names) const
+{
+    QList<bool> contained;
+    contained.reserve(names.size());
+    for(const QString& docName : names)
+        contained.append(mExistingDocuments.contains(IDataDoc::Identifier(type, translatedDocName(docName, type))));
 
-    // Cross reference with existing documents
-    return mExistingDocuments.intersects(searchSet);
+    return contained;
 }
 
 bool IInstall::supportsImageMode(Import::ImageMode imageMode) const { return preferredImageModeOrder().contains(imageMode); }
@@ -47,6 +89,50 @@ QList<QString> IInstall::modifiedDataDocs(IDataDoc::Type type) const
     return modList;
 }
 
+void IInstall::watchExistingDocs()
+{
+    /* Watching requires an event loop to deliver changes, so only the main thread can do it. Any change to the
+     * watched locations means the set has to be rebuilt, and the watch re-armed (new sub-directories, etc.).
+     *
+     * Only done on Linux, where the watch is a cheap inotify watch per directory. Elsewhere it holds an open handle
+     * on every directory in the tree, which can keep other programs from renaming or deleting them, so the set is
+     * just enumerated on every refresh there instead.
+     */
+#ifdef __linux__
+    const QStringList watchPaths = QThread::currentThread() == QCoreApplication::instance()->thread() ?
+                                   expandWatchPaths(existingDocWatchPaths()) : QStringList();
+#else
+    const QStringList watchPaths;
+#endif
+    if(watchPaths.isEmpty())
+    {
+        mDocWatcher.reset();
+        return;
+    }
+
+    if(!mDocWatcher)
+    {
+        mDocWatcher = std::make_unique<QFileSystemWatcher>();
+        auto markStale = [this]{ mExistingDocsStale = true; };
+        QObject::connect(mDocWatcher.get(), &QFileSystemWatcher::directoryChanged, mDocWatcher.get(), markStale);
+        QObject::connect(mDocWatcher.get(), &QFileSystemWatcher::fileChanged, mDocWatcher.get(), markStale);
+    }
+    else
+    {
+        if(QStringList watched = mDocWatcher->files() + mDocWatcher->directories(); !watched.isEmpty())
+            mDocWatcher->removePaths(watched);
+    }
+
+    // A partial watch (e.g. out of OS watch handles) can't be trusted
+    if(!mDocWatcher->addPaths(watchPaths).isEmpty())
+    {
+        mDocWatcher.reset();
+        return;
+    }
+
+    mExistingDocsStale = false;
+}
+
 //Protected:
 void IInstall::declareValid(bool valid)
 {
@@ -95,6 +181,11 @@ DocHandlingError IInstall::commitDataDocument(std::shared_ptr<IDataDoc::Writer>
         return DocHandlingError(*docToSave, DocHandlingError::CantCreateBackup);
     Q_ASSERT(!bErr.isValid()); // All relevant types should be handled here
 
+    /* The watcher only reports this once the event loop gets around to it, which may well be after the next
+     * refresh, so don't rely on it for changes FIL makes itself
+     */
+    mExistingDocsStale = true;
+
     // Error State
     DocHandlingError commitError;
 
@@ -124,18 +215,74 @@ void IInstall::closeDataDocument(std::unique_ptr<IDataDoc> doc)
     }
 }
 
+bool IInstall::canPrefetchDataDocument(const IDataDoc::Identifier& docId) const
+{
+    // Only docs that would actually be read and that are free to be leased are worth prefetching
+    return mExistingDocuments.contains(docId) && !mLeasedDocuments.contains(docId);
+}
+
+bool IInstall::isPrefetched(const IDataDoc::Identifier& docId) const
+{
+    return std::any_of(mPrefetches.cbegin(), mPrefetches.cend(), [&docId](const Prefetch& pf){
+        return pf.doc->identifier() == docId;
+    });
+}
+
+void IInstall::prefetchDataDocument(std::unique_ptr<IDataDoc> doc, std::shared_ptr<IDataDoc::Reader> docReader)
+{
+    Q_ASSERT(doc && docReader && docReader->target() == doc.get());
+    Q_ASSERT(canPrefetchDataDocument(doc->identifier()));
+
+    /* Take the lease up front so that the document cannot be checked out by other means while
+     * it's being read. Only the read itself happens off-thread; the lease ledger and post checkout
+     * handling are always touched from the calling thread.
+     */
+    mLeasedDocuments.insert(doc->identifier());
+    QFuture<DocHandlingError> read = QtConcurrent::run([docReader]{ return docReader->readInto(); });
+    mPrefetches.push_back(Prefetch{.doc = std::move(doc), .reader = std::move(docReader), .read = std::move(read)});
+}
+
+DocHandlingError IInstall::claimPrefetchedDataDocument(std::unique_ptr<IDataDoc>& returnBuffer, const IDataDoc::Identifier& docId)
+{
+    auto itr = std::find_if(mPrefetches.begin(), mPrefetches.end(), [&docId](const Prefetch& pf){
+        return pf.doc->identifier() == docId;
+    });
+    Q_ASSERT(itr != mPrefetches.end());
+
+    // Wait for read to finish, if it hasn't already
+    DocHandlingError readError = itr->read.result();
+    std::unique_ptr<IDataDoc> doc = std::move(itr->doc);
+    mPrefetches.erase(itr);
+
+    // Finish checkout the same way as a normal one
+    if(readError.isValid())
+        mLeasedDocuments.remove(docId);
+    else
+    {
+        doc->postCheckout();
+        returnBuffer = std::move(doc);
+    }
+
+    return readError;
+}
+
 QList<QString> IInstall::modifiedPlatforms() const { return modifiedDataDocs(IDataDoc::Type::Platform); }
 QList<QString> IInstall::modifiedPlaylists() const { return modifiedDataDocs(IDataDoc::Type::Playlist); }
 
 //Public:
 QString IInstall::versionString() const { return u"Unknown Version"_s; }
+bool IInstall::usesGameTags() const { return true; }
 bool IInstall::isValid() const { return mValid; }
 QString IInstall::path() const { return mRootDirectory.absolutePath(); }
 
 void IInstall::softReset()
 {
+    discardPrefetchedDocs();
     mModifiedDocuments.clear();
     mLeasedDocuments.clear();
+
+    // Docs may have been written or reverted since the last refresh, see commitDataDocument()
+    mExistingDocsStale = true;
 }
 
 QString IInstall::translateDocName(const QString& originalName, IDataDoc::Type type) const
@@ -144,24 +291,62 @@ QString IInstall::translateDocName(const QString& originalName, IDataDoc::Type t
     return originalName;
 }
 
+QString IInstall::translatedDocName(const QString& originalName, IDataDoc::Type type) const
+{
+    IDataDoc::Identifier key(type, originalName);
+    auto itr = mDocNameTranslations.constFind(key);
+    if(itr != mDocNameTranslations.cend())
+        return *itr;
+
+    QString translatedName = translateDocName(originalName, type);
+    mDocNameTranslations.insert(key, translatedName);
+    return translatedName;
+}
+
 Qx::Error IInstall::refreshExistingDocs(bool* changed)
 {
+    // Nothing to do if the watched locations have been quiet since the last refresh
+    if(mDocWatcher && !mExistingDocsStale)
+    {
+        if(changed)
+            *changed = false;
+        return {};
+    }
+
+    // Re-arm the watch before enumerating so that changes made during enumeration aren't missed
+    watchExistingDocs();
+
     QSet<IDataDoc::Identifier> oldDocSet;
     oldDocSet.swap(mExistingDocuments);
     Qx::Error error = populateExistingDocs(mExistingDocuments);
     if(changed)
         *changed = mExistingDocuments != oldDocSet;
+
+    // Try again next time if enumeration failed
+    if(error.isValid())
+        mExistingDocsStale = true;
+
     return error;
 }
 
 bool IInstall::containsPlatform(const QString& name) const
 {
-    return containsAnyDataDoc(IDataDoc::Type::Platform, {name});
+    return mExistingDocuments.contains(IDataDoc::Identifier(IDataDoc::Type::Platform, translatedDocName(name, IDataDoc::Type::Platform)));
 }
 
 bool IInstall::containsPlaylist(const QString& name) const
 {
-    return containsAnyDataDoc(IDataDoc::Type::Playlist, {name});
+    return mExistingDocuments.contains(IDataDoc::Identifier(IDataDoc::Type::Playlist, translatedDocName(name, IDataDoc::Type::Playlist)));
+}
+
+QList<bool> IInstall::containsPlatforms(const QList<QString>& names) const
+{
+    return containsDataDocs(IDataDoc::Type::Platform, names);
+}
+
+QList<bool> IInstall::containsPlaylists(const QList<QString>& names) const
+{
+    return containsDataDocs(IDataDoc::Type::Playlist, names);
 }
 
 bool IInstall::containsAnyPlatform(const QList<QString>& names) const
@@ -176,6 +361,18 @@ bool IInstall::containsAnyPlaylist(const QList<QString>& names) const
 
 bool IInstall::docIsLeased(IDataDoc::Identifier docId) const { return mLeasedDocuments.contains(docId); }
 
+void IInstall::discardPrefetchedDocs()
+{
+    // Docs must outlive their in-flight reads
+    for(Prefetch& pf : mPrefetches)
+    {
+        pf.read.waitForFinished();
+        mLeasedDocuments.remove(pf.doc->identifier());
+    }
+
+    mPrefetches.clear();
+}
+
 /* These functions can be overridden by children as needed.
  * Work within them should be kept as minimal as possible since they are not accounted
  * for by the import progress indicator.
@@ -189,6 +386,7 @@ Qx::Error IInstall::postImageProcessing() { return {}; }
 Qx::Error IInstall::prePlaylistsImport() { return {}; }
 Qx::Error IInstall::postPlaylistsImport() { return {}; }
 
+QStringList IInstall::existingDocWatchPaths() const { return {}; } // Watching disabled in default implementation
 QString IInstall::platformCategoryIconPath() const { return QString(); } // Unsupported in default implementation
 std::optional<QDir> IInstall::platformIconsDirectory() const { return std::nullopt; } // Unsupported in default implementation
 std::optional<QDir> IInstall::playlistIconsDirectory() const { return std::nullopt; } // Unsupported in default implementation
@@ -1,8 +1,13 @@
 #ifndef LR_INSTALL_INTERFACE_H
 #define LR_INSTALL_INTERFACE_H
 
+// Standard Library Includes
+#include <atomic>
+
 // Qt Includes
 #include <QDir>
+#include <QFuture>
+#include <QFileSystemWatcher>
 
 // Project Includes
 #include "launcher/interface/lr-data-interface.h"
@@ -13,6 +18,15 @@ namespace Lr
 
 class IInstall
 {
+//-Inner Classes-------------------------------------------------------------------------------------------------
+private:
+    struct Prefetch
+    {
+        std::unique_ptr<IDataDoc> doc;
+        std::shared_ptr<IDataDoc::Reader> reader;
+        QFuture<DocHandlingError> read;
+    };
+
 //-Instance Variables--------------------------------------------------------------------------------------------
 private:
     // Validity
@@ -25,6 +39,18 @@ private:
     QSet<IDataDoc::Identifier> mExistingDocuments;
     QSet<IDataDoc::Identifier> mModifiedDocuments;
     QSet<IDataDoc::Identifier> mLeasedDocuments;
+    std::vector<Prefetch> mPrefetches; // Always tiny, so a linear search is fine
+
+    /* Watches the locations existing docs are found in so that the set only needs to be rebuilt when something there
+     * actually changed. Only used for installs that provide those locations, and only while the watch is complete;
+     * otherwise every refresh falls back to a full enumeration. The flag is also raised directly whenever FIL itself
+     * commits or reverts docs, which can happen off the main thread during an import.
+     */
+    std::unique_ptr<QFileSystemWatcher> mDocWatcher;
+    std::atomic_bool mExistingDocsStale;
+
+    // Translations never change for a given install, so they're kept for its lifetime. Main thread only.
+    mutable QHash<IDataDoc::Identifier, QString> mDocNameTranslations; // Keyed by original name
 
 //-Constructor---------------------------------------------------------------------------------------------------
 public:
@@ -37,13 +63,16 @@ public:
 //-Class Functions------------------------------------------------------------------------------------------------------
 private:
     static void ensureModifiable(const QString& filePath);
+    static QStringList expandWatchPaths(const QStringList& roots);
 
 //-Instance Functions---------------------------------------------------------------------------------------------------------
 private:
     // Support
     bool containsAnyDataDoc(IDataDoc::Type type, const QList<QString>& names) const;
+    QList<bool> containsDataDocs(IDataDoc::Type type, const QList<QString>& names) const;
     bool supportsImageMode(Import::ImageMode imageMode) const; // TODO: UNUSED
     QList<QString> modifiedDataDocs(IDataDoc::Type type) const;
+    void watchExistingDocs();
 
 protected:
     // Validity
@@ -53,9 +82,14 @@ protected:
     DocHandlingError checkoutDataDocument(std::shared_ptr<IDataDoc::Reader> docReader);
     DocHandlingError commitDataDocument(std::shared_ptr<IDataDoc::Writer> docWriter);
     void closeDataDocument(std::unique_ptr<IDataDoc> doc);
+    bool canPrefetchDataDocument(const IDataDoc::Identifier& docId) const;
+    bool isPrefetched(const IDataDoc::Identifier& docId) const;
+    void prefetchDataDocument(std::unique_ptr<IDataDoc> doc, std::shared_ptr<IDataDoc::Reader> docReader);
+    DocHandlingError claimPrefetchedDataDocument(std::unique_ptr<IDataDoc>& returnBuffer, const IDataDoc::Identifier& docId);
     QList<QString> modifiedPlatforms() const;
     QList<QString> modifiedPlaylists() const;
     virtual Qx::Error populateExistingDocs(QSet<IDataDoc::Identifier>& existingDocs) = 0;
+    virtual QStringList existingDocWatchPaths() const; // Directories are watched recursively, empty disables watching
 
 public:
     // Details
@@ -63,6 +97,7 @@ public:
     virtual QList<Import::ImageMode> preferredImageModeOrder() const = 0;
     virtual QString versionString() const;
     virtual bool isRunning() const = 0;
+    virtual bool usesGameTags() const; // Whether imported sets need their game's tags, which cost a query per game
 
     bool isValid() const;
     QString path() const;
@@ -70,12 +105,18 @@ public:
 
     // Docs
     virtual QString translateDocName(const QString& originalName, IDataDoc::Type type) const;
+    QString translatedDocName(const QString& originalName, IDataDoc::Type type) const; // Cached translateDocName()
     Qx::Error refreshExistingDocs(bool* changed = nullptr);
     bool containsPlatform(const QString& name) const;
     bool containsPlaylist(const QString& name) const;
+    QList<bool> containsPlatforms(const QList<QString>& names) const; // Per name, in order
+    QList<bool> containsPlaylists(const QList<QString>& names) const; // Per name, in order
     bool containsAnyPlatform(const QList<QString>& names) const; // Unused
     bool containsAnyPlaylist(const QList<QString>& names) const; // Unused
     bool docIsLeased(IDataDoc::Identifier docId) const;
+    void discardPrefetchedDocs();
+
+    virtual void prefetchPlatformDoc(const QString& name) = 0;
 
     virtual DocHandlingError checkoutPlatformDoc(std::unique_ptr<IPlatformDoc>& returnBuffer, const QString& name) = 0;
     virtual DocHandlingError checkoutPlaylistDoc(std::unique_ptr<IPlaylistDoc>& returnBuffer, const QString& name) = 0;
@@ -10,13 +10,26 @@ namespace Lr
 
 //-Constructor------------------------------------------------------------------------------------------------
 //Public:
-Item::Item() {}
+Item::Item() :
+    mUnmodifiedOriginal(false)
+{}
 
 //-Instance Functions------------------------------------------------------------------------------------------------
 //Public:
 QList<Item::OtherField>& Item::otherFields() { return mOtherFields; }
 const QList<Item::OtherField>& Item::otherFields() const { return mOtherFields; }
-void Item::copyOtherFields(const Item& other) { mOtherFields = other.mOtherFields; }
+
+void Item::copyOtherFields(const Item& other)
+{
+    // The markup comes along since it may still hold the other fields, but this item is no longer the original
+    mOtherFields = other.mOtherFields;
+    mOriginalMarkup = other.mOriginalMarkup;
+    mUnmodifiedOriginal = false;
+}
+
+QByteArrayView Item::originalMarkup() const { return mOriginalMarkup; }
+bool Item::hasDeferredOtherFields() const { return !mOriginalMarkup.isEmpty(); }
+bool Item::isUnmodifiedOriginal() const { return mUnmodifiedOriginal; }
 
 //===============================================================================================================
 // BasicItem
@@ -61,7 +74,7 @@ Game::Game() {}
 
 Game::Game(const QUuid& id, const QString& name, const QString& platform) :
     NamedItem(id, name),
-    mPlatform(platform)
+    mPlatform(Import::StringPool::intern(platform))
 {}
 
 //-Instance Functions------------------------------------------------------------------------------------------------
@@ -3,14 +3,19 @@
 
 // Standard Library Includes
 #include <concepts>
+#include <utility>
 
 // Qt Includes
 #include <QHash>
 #include <QUuid>
+#include <QByteArrayView>
 
 // Qx Includes
 #include <qx/utility/qx-concepts.h>
 
+// Project Includes
+#include "import/stringpool.h"
+
 using namespace Qt::Literals::StringLiterals;
 
 namespace Lr
@@ -29,8 +34,6 @@ namespace Lr
  * be able to work with it
  */
 
-// TODO: In the long run, a mild optimization would be to add "emplace()" style methods for things like builders
-
 class Item;
 class BasicItem;
 class NamedItem;
@@ -71,7 +74,8 @@ protected:
 
 //-Instance Functions------------------------------------------------------------------------------------------
 public:
-    T build() const { return mBlueprint; }
+    T build() const & { return mBlueprint; }
+    T build() && { return std::move(mBlueprint); } // For builders that are done with, avoids copying the blueprint
 };
 
 class Item
@@ -99,6 +103,13 @@ public:
 protected:
     QList<OtherField> mOtherFields;
 
+    /* Markup of the item as it appeared in the document it was read from, for readers that leave the other fields
+     * there instead of parsing them out. It views memory owned by the item's document. An item that is still exactly
+     * as it was read can be written back out using just this markup.
+     */
+    QByteArrayView mOriginalMarkup;
+    bool mUnmodifiedOriginal;
+
 //-Constructor-------------------------------------------------------------------------------------------------
 public:
     Item();
@@ -108,6 +119,10 @@ public:
     QList<OtherField>& otherFields();
     const QList<OtherField>& otherFields() const;
     void copyOtherFields(const Item& other);
+
+    QByteArrayView originalMarkup() const;
+    bool hasDeferredOtherFields() const;
+    bool isUnmodifiedOriginal() const;
 };
 
 template<item T>
@@ -120,10 +135,18 @@ protected:
 //-Instance Functions------------------------------------------------------------------------------------------
 public:
     template<class Self>
-    auto wOtherField(this Self&& self, OtherField&& otherField)
+    Self&& wOtherField(this Self&& self, OtherField&& otherField)
     {
         self.mBlueprint.mOtherFields.append(std::move(otherField));
-        return self;
+        return std::forward<Self>(self);
+    }
+
+    template<class Self>
+    Self&& wOriginalMarkup(this Self&& self, QByteArrayView markup)
+    {
+        self.mBlueprint.mOriginalMarkup = markup;
+        self.mBlueprint.mUnmodifiedOriginal = true;
+        return std::forward<Self>(self);
     }
 };
 
@@ -170,10 +193,10 @@ class BasicItem::Builder : public Item::Builder<T>
 //-Instance Functions------------------------------------------------------------------------------------------
 public:
     template<class Self>
-    auto wId(this Self&& self, const QString& rawId) { self.mBlueprint.mId = QUuid(rawId); return self; }
+    Self&& wId(this Self&& self, const QString& rawId) { self.mBlueprint.mId = QUuid(rawId); return std::forward<Self>(self); }
 
     template<class Self>
-    auto wId(this Self&& self, const QUuid& id) { self.mBlueprint.mId = id; return self; }
+    Self&& wId(this Self&& self, const QUuid& id) { self.mBlueprint.mId = id; return std::forward<Self>(self); }
 };
 
 class NamedItem : public BasicItem
@@ -203,7 +226,7 @@ class NamedItem::Builder : public BasicItem::Builder<T>
 //-Instance Functions------------------------------------------------------------------------------------------
 public:
     template<class Self>
-    auto wName(this Self&& self, const QString& name) { self.mBlueprint.mName = name; return self;}
+    Self&& wName(this Self&& self, const QString& name) { self.mBlueprint.mName = name; return std::forward<Self>(self);}
 };
 
 class Game : public NamedItem
@@ -238,7 +261,7 @@ class Game::Builder : public NamedItem::Builder<T>
 //-Instance Functions------------------------------------------------------------------------------------------
 public:
     template<class Self>
-    auto wPlatform(this Self&& self, const QString& platform) { self.mBlueprint.mPlatform = platform; return self; }
+    Self&& wPlatform(this Self&& self, const QString& platform) { self.mBlueprint.mPlatform = Import::StringPool::intern(platform); return std::forward<Self>(self); }
 };
 
 class AddApp : public NamedItem
@@ -268,10 +291,10 @@ class AddApp::Builder : public NamedItem::Builder<T>
 //-Instance Functions------------------------------------------------------------------------------------------
 public:
     template<class Self>
-    auto wGameId(this Self&& self, const QString& rawGameId) { self.mBlueprint.mGameId = QUuid(rawGameId); return self; }
+    Self&& wGameId(this Self&& self, const QString& rawGameId) { self.mBlueprint.mGameId = QUuid(rawGameId); return std::forward<Self>(self); }
 
     template<class Self>
-    auto wGameId(this Self&& self, const QUuid& gameId) { self.mBlueprint.mGameId = gameId; return self; }
+    Self&& wGameId(this Self&& self, const QUuid& gameId) { self.mBlueprint.mGameId = gameId; return std::forward<Self>(self); }
 };
 
 class PlaylistHeader : public NamedItem
@@ -318,10 +341,10 @@ class PlaylistGame::Builder : public NamedItem::Builder<T>
 public:
     // These reuse the main ID on purpose, in this case gameId is a proxy for Id
     template<class Self>
-    auto wGameId(this Self&& self, QString rawGameId) { self.mBlueprint.mId = QUuid(rawGameId); return self; }
+    Self&& wGameId(this Self&& self, QString rawGameId) { self.mBlueprint.mId = QUuid(rawGameId); return std::forward<Self>(self); }
 
     template<class Self>
-    auto wGameId(this Self&& self, QUuid gameId) { self.mBlueprint.mId = gameId; return self; }
+    Self&& wGameId(this Self&& self, QUuid gameId) { self.mBlueprint.mId = gameId; return std::forward<Self>(self); }
 };
 
 }
@@ -240,44 +240,8 @@ void MainWindow::initializeBindings()
     });
     b.flashpointStatus.subscribeLifetime([&]{ ui->icon_flashpoint_install_status->setPixmap(b.flashpointStatus); });
 
-    // Tag map
-    mImportProperties.bindableTagMap().subscribeLifetime([&]{
-        // Populate model
-        const auto tagMap = mImportProperties.tagMap();
-        if(tagMap.isEmpty())
-        {
-            mTagModel.clear();
-            return;
-        }
-
-        QStandardItem* modelRoot = mTagModel.invisibleRootItem();
-
-        // Add root tag categories
-        for(const Fp::Db::TagCategory& tc : tagMap)
-        {
-            QStandardItem* rootItem = new QStandardItem(QString(tc.name));
-            rootItem->setData(QBrush(tc.color), Qt::BackgroundRole);
-            rootItem->setData(QBrush(Qx::Color::textFromBackground(tc.color)), Qt::ForegroundRole);
-            rootItem->setCheckState(Qt::CheckState::Checked);
-            rootItem->setCheckable(true);
-
-            // Add child tags
-            for(const Fp::Db::Tag& tag : tc.tags)
-            {
-                QStandardItem* childItem = new QStandardItem(QString(tag.primaryAlias));
-                childItem->setData(tag.id, USER_ROLE_TAG_ID);
-                childItem->setCheckState(Qt::CheckState::Checked);
-                childItem->setCheckable(true);
-
-                rootItem->appendRow(childItem);
-            }
-
-            modelRoot->appendRow(rootItem);
-        }
-
-        // Sort
-        mTagModel.sort(0);
-    });
+    // Tag model, which is only populated once it's needed since there can be thousands of tags
+    b.editTagFilterEnabled.addLifetimeNotifier([&]{ mTagModel.clear(); });
 
     // List widget items
     mImportProperties.bindablePlatforms().subscribeLifetime([&]{
@@ -410,10 +374,44 @@ void MainWindow::prepareImport()
     emit importTriggered(impSel, optSet, selectionsMayModify());
 }
 
+void MainWindow::populateTagModel()
+{
+    mTagModel.clear();
+    QStandardItem* modelRoot = mTagModel.invisibleRootItem();
+
+    // Add root tag categories
+    const auto tagMap = mImportProperties.tagMap();
+    for(const Fp::Db::TagCategory& tc : tagMap)
+    {
+        QStandardItem* rootItem = new QStandardItem(QString(tc.name));
+        rootItem->setData(QBrush(tc.color), Qt::BackgroundRole);
+        rootItem->setData(QBrush(Qx::Color::textFromBackground(tc.color)), Qt::ForegroundRole);
+        rootItem->setCheckState(Qt::CheckState::Checked);
+        rootItem->setCheckable(true);
+
+        // Add child tags
+        for(const Fp::Db::Tag& tag : tc.tags)
+        {
+            QStandardItem* childItem = new QStandardItem(QString(tag.primaryAlias));
+            childItem->setData(tag.id, USER_ROLE_TAG_ID);
+            childItem->setCheckState(Qt::CheckState::Checked);
+            childItem->setCheckable(true);
+
+            rootItem->appendRow(childItem);
+        }
+
+        modelRoot->appendRow(rootItem);
+    }
+
+    // Sort
+    mTagModel.sort(0);
+}
+
 void MainWindow::showTagSelectionDialog()
 {
-    // Ensure tags have been populated
-    Q_ASSERT(mTagModel.rowCount() > 0);
+    // Populate tags on first use, until then all of them are implicitly selected
+    if(mTagModel.rowCount() == 0)
+        populateTagModel();
 
     // Cache current selection states
     QHash<QStandardItem*,Qt::CheckState> originalCheckStates;
@@ -439,6 +437,7 @@ QList<int> MainWindow::generateTagExlusionSet() const
 {
     QList<int> exclusionSet;
 
+    // If the model was never populated, nothing was deselected
     mTagModel.forEachItem([&exclusionSet](QStandardItem* item){
         if(item->data(USER_ROLE_TAG_ID).isValid() && item->checkState() == Qt::Unchecked)
             exclusionSet.append(item->data(USER_ROLE_TAG_ID).toInt());
@@ -187,6 +187,7 @@ private:
     void prepareImport();
 
     // Tags (move to controller?)
+    void populateTagModel();
     void showTagSelectionDialog();
     QList<int> generateTagExlusionSet() const;
 